@@ -0,0 +1,157 @@
+// Global operator new/delete replacement backing allocation_tracker.hpp.
+// Every form forwards to malloc/free. While a tracker is active, each
+// allocation bumps the counters, and live bytes follow the allocator's
+// usable block size, so frees of blocks allocated before start() balance
+// correctly against the peak.
+
+#include "allocation_tracker.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+
+#if defined(__APPLE__)
+#include <malloc/malloc.h>
+#else
+#include <malloc.h>
+#endif
+
+namespace {
+
+std::atomic<bool> g_active(false);
+std::atomic<std::uint64_t> g_allocations(0);
+std::atomic<std::uint64_t> g_bytes(0);
+std::atomic<std::int64_t> g_live_bytes(0);
+std::atomic<std::int64_t> g_peak_live_bytes(0);
+
+std::size_t block_size(void* ptr) {
+#if defined(__APPLE__)
+  return malloc_size(ptr);
+#else
+  return malloc_usable_size(ptr);
+#endif
+}
+
+void record_allocation(void* ptr, std::size_t size) {
+  if (!ptr || !g_active.load(std::memory_order_relaxed)) {
+    return;
+  }
+  g_allocations.fetch_add(1, std::memory_order_relaxed);
+  g_bytes.fetch_add(size, std::memory_order_relaxed);
+  std::int64_t block = block_size(ptr);
+  std::int64_t live = g_live_bytes.fetch_add(block, std::memory_order_relaxed) + block;
+  std::int64_t peak = g_peak_live_bytes.load(std::memory_order_relaxed);
+  while (live > peak &&
+         !g_peak_live_bytes.compare_exchange_weak(peak, live, std::memory_order_relaxed)) {
+  }
+}
+
+void record_deallocation(void* ptr) {
+  if (ptr && g_active.load(std::memory_order_relaxed)) {
+    g_live_bytes.fetch_sub(block_size(ptr), std::memory_order_relaxed);
+  }
+}
+
+void* allocate(std::size_t size, std::size_t alignment) {
+  if (size == 0) {
+    size = 1;
+  }
+  for (;;) {
+    void* ptr = nullptr;
+    if (alignment <= alignof(std::max_align_t)) {
+      ptr = std::malloc(size);
+    } else if (posix_memalign(&ptr, alignment, size) != 0) {
+      ptr = nullptr;
+    }
+    if (ptr) {
+      record_allocation(ptr, size);
+      return ptr;
+    }
+    std::new_handler handler = std::get_new_handler();
+    if (!handler) {
+      throw std::bad_alloc();
+    }
+    handler();
+  }
+}
+
+void* allocate_nothrow(std::size_t size, std::size_t alignment) noexcept {
+  try {
+    return allocate(size, alignment);
+  } catch (...) {
+    return nullptr;
+  }
+}
+
+void deallocate(void* ptr) noexcept {
+  record_deallocation(ptr);
+  std::free(ptr);
+}
+
+} // namespace
+
+namespace allocations {
+
+void start() {
+  g_allocations.store(0, std::memory_order_relaxed);
+  g_bytes.store(0, std::memory_order_relaxed);
+  g_live_bytes.store(0, std::memory_order_relaxed);
+  g_peak_live_bytes.store(0, std::memory_order_relaxed);
+  g_active.store(true, std::memory_order_release);
+}
+
+Totals stop() {
+  g_active.store(false, std::memory_order_release);
+  return Totals{g_allocations.load(std::memory_order_relaxed),
+                g_bytes.load(std::memory_order_relaxed),
+                g_peak_live_bytes.load(std::memory_order_relaxed),
+                g_live_bytes.load(std::memory_order_relaxed)};
+}
+
+} // namespace allocations
+
+void* operator new(std::size_t size) {
+  return allocate(size, alignof(std::max_align_t));
+}
+
+void* operator new[](std::size_t size) {
+  return allocate(size, alignof(std::max_align_t));
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept {
+  return allocate_nothrow(size, alignof(std::max_align_t));
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept {
+  return allocate_nothrow(size, alignof(std::max_align_t));
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment) {
+  return allocate(size, static_cast<std::size_t>(alignment));
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment) {
+  return allocate(size, static_cast<std::size_t>(alignment));
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept {
+  return allocate_nothrow(size, static_cast<std::size_t>(alignment));
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept {
+  return allocate_nothrow(size, static_cast<std::size_t>(alignment));
+}
+
+void operator delete(void* ptr) noexcept { deallocate(ptr); }
+void operator delete[](void* ptr) noexcept { deallocate(ptr); }
+void operator delete(void* ptr, std::size_t) noexcept { deallocate(ptr); }
+void operator delete[](void* ptr, std::size_t) noexcept { deallocate(ptr); }
+void operator delete(void* ptr, const std::nothrow_t&) noexcept { deallocate(ptr); }
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept { deallocate(ptr); }
+void operator delete(void* ptr, std::align_val_t) noexcept { deallocate(ptr); }
+void operator delete[](void* ptr, std::align_val_t) noexcept { deallocate(ptr); }
+void operator delete(void* ptr, std::size_t, std::align_val_t) noexcept { deallocate(ptr); }
+void operator delete[](void* ptr, std::size_t, std::align_val_t) noexcept { deallocate(ptr); }
+void operator delete(void* ptr, std::align_val_t, const std::nothrow_t&) noexcept { deallocate(ptr); }
+void operator delete[](void* ptr, std::align_val_t, const std::nothrow_t&) noexcept { deallocate(ptr); }
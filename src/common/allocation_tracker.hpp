@@ -0,0 +1,66 @@
+#pragma once
+
+// Heap allocation accounting for the benchmark executables.
+// allocation_tracker.cpp replaces the global operator new/delete for every
+// target; allocations are only counted while an allocations::Tracker is
+// alive, so untracked benchmarks pay a single relaxed load per call.
+//
+// Usage:
+//   allocations::Tracker tracker;
+//   for (auto _ : state) { ... }
+//   tracker.report(state);   // AllocsPerIter, BytesPerIter, PeakLiveBytes
+
+#include <benchmark/benchmark.h>
+#include <cstdint>
+
+namespace allocations {
+
+// Counters since the tracker was started. Only one tracker may be active at
+// a time; allocations from every thread are attributed to it.
+struct Totals {
+  std::uint64_t allocations;
+  std::uint64_t bytes;          // Bytes requested from operator new
+  std::int64_t peak_live_bytes; // High-water mark of live bytes above the start
+  std::int64_t live_bytes;      // Live bytes above the start when stopped
+};
+
+void start();
+Totals stop();
+
+class Tracker {
+public:
+  Tracker() { start(); }
+  ~Tracker() {
+    if (m_active) {
+      allocations::stop();
+    }
+  }
+
+  Tracker(const Tracker&) = delete;
+  Tracker& operator=(const Tracker&) = delete;
+
+  // Stop tracking and return the totals
+  Totals stop() {
+    m_active = false;
+    return allocations::stop();
+  }
+
+  // Stop tracking and attach per-iteration counters to state
+  Totals report(benchmark::State& state) {
+    Totals totals = stop();
+    state.counters["AllocsPerIter"] = benchmark::Counter(
+      static_cast<double>(totals.allocations), benchmark::Counter::kAvgIterations);
+    state.counters["BytesPerIter"] = benchmark::Counter(
+      static_cast<double>(totals.bytes), benchmark::Counter::kAvgIterations,
+      benchmark::Counter::OneK::kIs1024);
+    state.counters["PeakLiveBytes"] = benchmark::Counter(
+      static_cast<double>(totals.peak_live_bytes), benchmark::Counter::kDefaults,
+      benchmark::Counter::OneK::kIs1024);
+    return totals;
+  }
+
+private:
+  bool m_active = true;
+};
+
+} // namespace allocations
@@ -0,0 +1,102 @@
+#pragma once
+
+// Allocation strategies for the container benchmarks. A strategy object
+// owns whatever memory resource backs one container's lifetime and hands
+// out allocators for any value type:
+//
+//   Strategy strategy;
+//   std::map<K, V, std::less<K>, Strategy::allocator<std::pair<const K, V>>>
+//     m(strategy.get<std::pair<const K, V>>());
+//
+// Benchmarks construct a fresh strategy per iteration, the way an arena is
+// created per request and dropped wholesale afterwards. The Boost.Container
+// pools obtain memory from Boost.Container's own malloc rather than operator
+// new, so allocations::Tracker does not see them; each strategy's tracked
+// flag says whether the tracker's counters mean anything for it, and
+// allocators::report() only attaches them when they do.
+
+#include "allocation_tracker.hpp"
+
+#include <boost/container/adaptive_pool.hpp>
+#include <boost/container/node_allocator.hpp>
+#include <boost/container/pmr/monotonic_buffer_resource.hpp>
+#include <boost/container/pmr/polymorphic_allocator.hpp>
+#include <boost/container/pmr/unsynchronized_pool_resource.hpp>
+#include <memory>
+
+namespace allocators {
+
+// Global operator new/delete
+struct Std {
+  static constexpr bool tracked = true;
+
+  template <typename T>
+  using allocator = std::allocator<T>;
+
+  template <typename T>
+  allocator<T> get() { return allocator<T>(); }
+};
+
+// Bump-pointer arena: deallocation is a no-op and all memory is released
+// when the strategy is destroyed
+struct Monotonic {
+  static constexpr bool tracked = true;
+
+  template <typename T>
+  using allocator = boost::container::pmr::polymorphic_allocator<T>;
+
+  template <typename T>
+  allocator<T> get() { return allocator<T>(&resource); }
+
+  boost::container::pmr::monotonic_buffer_resource resource;
+};
+
+// Size-class pools without locking, recycling freed blocks
+struct UnsynchronizedPool {
+  static constexpr bool tracked = true;
+
+  template <typename T>
+  using allocator = boost::container::pmr::polymorphic_allocator<T>;
+
+  template <typename T>
+  allocator<T> get() { return allocator<T>(&resource); }
+
+  boost::container::pmr::unsynchronized_pool_resource resource;
+};
+
+// Process-wide pool that returns fully free blocks to the system
+struct AdaptivePool {
+  static constexpr bool tracked = false;
+
+  template <typename T>
+  using allocator = boost::container::adaptive_pool<T>;
+
+  template <typename T>
+  allocator<T> get() { return allocator<T>(); }
+};
+
+// Process-wide simple segregated storage pool for single nodes
+struct NodePool {
+  static constexpr bool tracked = false;
+
+  template <typename T>
+  using allocator = boost::container::node_allocator<T>;
+
+  template <typename T>
+  allocator<T> get() { return allocator<T>(); }
+};
+
+// Stop tracker and attach its counters to state, unless the strategy's
+// memory bypasses operator new; those rows are labelled instead, since the
+// counters would only show allocations made outside the strategy
+template <typename Allocation>
+void report(allocations::Tracker& tracker, benchmark::State& state) {
+  if (Allocation::tracked) {
+    tracker.report(state);
+  } else {
+    tracker.stop();
+    state.SetLabel("allocations not tracked");
+  }
+}
+
+} // namespace allocators
@@ -0,0 +1,465 @@
+#pragma once
+
+// Deterministic, seed-controlled workload generators shared by the benchmark
+// executables. Every generator takes an explicit seed (defaulting to
+// default_seed()) so that repeated runs benchmark exactly the same inputs.
+//
+// Environment variables:
+//   BOOST_BENCH_SEED       overrides the default seed (42)
+//   BOOST_BENCH_CACHE_DIR  directory for cached workloads; defaults to
+//                          <tmp>/boost-bench-workloads, empty disables caching
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <string>
+#include <system_error>
+#include <type_traits>
+#include <unordered_set>
+#include <vector>
+
+namespace workloads {
+
+// Seed used when a generator is not given one explicitly
+inline std::uint64_t default_seed() {
+  static const std::uint64_t seed = [] {
+    const char* env = std::getenv("BOOST_BENCH_SEED");
+    return env ? std::strtoull(env, nullptr, 10) : 42;
+  }();
+  return seed;
+}
+
+// Directed, weighted edge as stored in generated edge lists and on disk
+struct Edge {
+  std::uint32_t source;
+  std::uint32_t target;
+  std::int32_t weight;
+};
+
+typedef std::vector<Edge> EdgeList;
+
+// ---------------------------------------------------------------------------
+// On-disk cache
+// ---------------------------------------------------------------------------
+
+// Directory holding cached workloads, or an empty path if caching is disabled
+inline std::filesystem::path cache_directory() {
+  if (const char* env = std::getenv("BOOST_BENCH_CACHE_DIR")) {
+    return std::filesystem::path(env);
+  }
+  std::error_code ec;
+  auto tmp = std::filesystem::temp_directory_path(ec);
+  return ec ? std::filesystem::path() : tmp / "boost-bench-workloads";
+}
+
+// Version of the cached generator output and file layout. Bump it whenever
+// a cached generator changes what it produces, so stale files are ignored.
+const std::uint64_t cache_version = 2;
+
+// Return the records cached under key, generating and storing them on a miss.
+// The file layout is a small header (magic, version, record size, count)
+// followed by the raw records. Any I/O failure or mismatching header falls
+// back to plain generation, so a read-only, missing or corrupt cache never
+// fails a benchmark.
+template <typename Record, typename Generator>
+std::vector<Record> cached(const std::string& key, Generator generate) {
+  static_assert(std::is_trivially_copyable<Record>::value,
+                "cached records are stored as raw bytes");
+  const std::uint64_t magic = 0x626f6f73742d7763ULL; // "boost-wc"
+  
+  std::filesystem::path dir = cache_directory();
+  if (dir.empty()) {
+    return generate();
+  }
+  std::filesystem::path file = dir / (key + ".v" + std::to_string(cache_version) + ".bin");
+  
+  // Cache hit, only if the header matches and the file holds exactly the
+  // records it announces
+  {
+    std::ifstream in(file, std::ios::binary);
+    std::uint64_t header[4];
+    std::error_code size_ec;
+    std::uintmax_t file_size = std::filesystem::file_size(file, size_ec);
+    if (in && !size_ec && in.read(reinterpret_cast<char*>(header), sizeof(header)) &&
+        header[0] == magic && header[1] == cache_version && header[2] == sizeof(Record) &&
+        header[3] == (file_size - sizeof(header)) / sizeof(Record) &&
+        file_size - sizeof(header) == header[3] * sizeof(Record)) {
+      std::vector<Record> records(header[3]);
+      if (in.read(reinterpret_cast<char*>(records.data()), records.size() * sizeof(Record))) {
+        return records;
+      }
+    }
+  }
+  
+  // Cache miss: generate, then publish atomically so concurrent benchmark
+  // processes never observe a partially written file
+  std::vector<Record> records = generate();
+  std::error_code ec;
+  std::filesystem::create_directories(dir, ec);
+  std::filesystem::path tmp = file;
+  tmp += ".tmp" + std::to_string(std::random_device{}());
+  {
+    std::ofstream out(tmp, std::ios::binary);
+    std::uint64_t header[4] = {magic, cache_version, sizeof(Record), records.size()};
+    out.write(reinterpret_cast<const char*>(header), sizeof(header));
+    out.write(reinterpret_cast<const char*>(records.data()), records.size() * sizeof(Record));
+    if (!out) {
+      out.close();
+      std::filesystem::remove(tmp, ec);
+      return records;
+    }
+  }
+  std::filesystem::rename(tmp, file, ec);
+  if (ec) {
+    std::filesystem::remove(tmp, ec);
+  }
+  return records;
+}
+
+// ---------------------------------------------------------------------------
+// Graphs
+// ---------------------------------------------------------------------------
+
+// num_edges uniform (source, target, weight) draws, including self-loops and
+// duplicate edges, as a graph loader would receive them
+inline EdgeList uniform_edge_draws(int num_vertices, int num_edges, int max_weight,
+                                   std::uint64_t seed = default_seed()) {
+  std::mt19937 gen(static_cast<std::uint32_t>(seed));
+  std::uniform_int_distribution<> vertex_dist(0, num_vertices - 1);
+  std::uniform_int_distribution<> weight_dist(1, max_weight);
+  
+  EdgeList edges(num_edges);
+  for (auto& edge : edges) {
+    edge.source = vertex_dist(gen);
+    edge.target = vertex_dist(gen);
+    edge.weight = weight_dist(gen);
+  }
+  return edges;
+}
+
+// Uniform random graph: the draws of uniform_edge_draws without self-loops
+// and duplicates. For undirected graphs (u, v) and (v, u) count as the same
+// edge. The first draw of an edge wins.
+inline EdgeList random_edges(int num_vertices, int num_edges, int max_weight, bool undirected,
+                             std::uint64_t seed = default_seed()) {
+  EdgeList edges = uniform_edge_draws(num_vertices, num_edges, max_weight, seed);
+  std::unordered_set<std::uint64_t> seen;
+  seen.reserve(num_edges);
+  
+  auto duplicate = [&](const Edge& edge) {
+    // Skip self-loops
+    if (edge.source == edge.target) {
+      return true;
+    }
+    std::uint32_t lo = undirected ? std::min(edge.source, edge.target) : edge.source;
+    std::uint32_t hi = undirected ? std::max(edge.source, edge.target) : edge.target;
+    return !seen.insert((static_cast<std::uint64_t>(lo) << 32) | hi).second;
+  };
+  edges.erase(std::remove_if(edges.begin(), edges.end(), duplicate), edges.end());
+  
+  return edges;
+}
+
+// R-MAT (recursive matrix) power-law graph with 2^scale vertices and
+// edge_factor * 2^scale edge draws, using the Graph500 quadrant
+// probabilities. Vertex ids are randomly permuted so high-degree vertices are
+// not clustered at low ids. Self-loops are dropped; parallel edges are kept,
+// as in the Graph500 generator.
+inline EdgeList rmat_edges(int scale, int edge_factor, int max_weight,
+                           std::uint64_t seed = default_seed(),
+                           double a = 0.57, double b = 0.19, double c = 0.19) {
+  const std::uint64_t num_vertices = std::uint64_t(1) << scale;
+  const std::uint64_t num_edges = num_vertices * edge_factor;
+  
+  std::mt19937_64 gen(seed);
+  std::uniform_real_distribution<double> quadrant_dist(0.0, 1.0);
+  std::uniform_int_distribution<> weight_dist(1, max_weight);
+  
+  std::vector<std::uint32_t> permutation(num_vertices);
+  for (std::uint64_t v = 0; v < num_vertices; ++v) {
+    permutation[v] = static_cast<std::uint32_t>(v);
+  }
+  std::shuffle(permutation.begin(), permutation.end(), gen);
+  
+  EdgeList edges;
+  edges.reserve(num_edges);
+  for (std::uint64_t i = 0; i < num_edges; ++i) {
+    std::uint64_t source = 0;
+    std::uint64_t target = 0;
+    for (int level = 0; level < scale; ++level) {
+      double r = quadrant_dist(gen);
+      source <<= 1;
+      target <<= 1;
+      if (r < a) {
+        // Top-left quadrant
+      } else if (r < a + b) {
+        target |= 1;
+      } else if (r < a + b + c) {
+        source |= 1;
+      } else {
+        source |= 1;
+        target |= 1;
+      }
+    }
+    if (source != target) {
+      edges.push_back(Edge{permutation[source], permutation[target], weight_dist(gen)});
+    }
+  }
+  
+  return edges;
+}
+
+// Cached variants keyed by every generator parameter, for workloads large
+// enough that regenerating them in every benchmark process is noticeable
+inline EdgeList cached_random_edges(int num_vertices, int num_edges, int max_weight, bool undirected,
+                                    std::uint64_t seed = default_seed()) {
+  std::string key = "random_" + std::to_string(num_vertices) + "_" + std::to_string(num_edges) + "_" +
+                    std::to_string(max_weight) + (undirected ? "_u_" : "_d_") + std::to_string(seed);
+  return cached<Edge>(key, [&] {
+    return random_edges(num_vertices, num_edges, max_weight, undirected, seed);
+  });
+}
+
+inline EdgeList cached_rmat_edges(int scale, int edge_factor, int max_weight,
+                                  std::uint64_t seed = default_seed()) {
+  std::string key = "rmat_" + std::to_string(scale) + "_" + std::to_string(edge_factor) + "_" +
+                    std::to_string(max_weight) + "_" + std::to_string(seed);
+  return cached<Edge>(key, [&] {
+    return rmat_edges(scale, edge_factor, max_weight, seed);
+  });
+}
+
+// Obstacle cells (row-major indices) of a width x height grid: 10% of the
+// cells are drawn uniformly, with repetition. The two corner cells used as
+// search endpoints (first and last) are never blocked, otherwise a fixed seed
+// could pin a grid size to a trivially failing search.
+inline std::vector<int> grid_obstacles(int width, int height, std::uint64_t seed = default_seed()) {
+  std::mt19937 gen(static_cast<std::uint32_t>(seed));
+  std::uniform_int_distribution<> cell_dist(1, width * height - 2);
+  
+  std::vector<int> obstacles((width * height) / 10);
+  for (auto& cell : obstacles) {
+    cell = cell_dist(gen);
+  }
+  return obstacles;
+}
+
+// ---------------------------------------------------------------------------
+// Container keys
+// ---------------------------------------------------------------------------
+
+enum KeyDistribution {
+  kSequentialKeys = 0, // 0, 1, 2, ...
+  kRandomKeys,         // Uniform over 64 bits
+  kClusteredKeys,      // Runs of 64 consecutive keys at random bases
+  kStringKeys          // Decimal strings of random 64-bit values
+};
+
+// splitmix64 finalizer: a bijection on 64-bit values, so distinct indices
+// always give distinct keys
+inline std::uint64_t mix64(std::uint64_t x) {
+  x ^= x >> 30;
+  x *= 0xbf58476d1ce4e5b9ULL;
+  x ^= x >> 27;
+  x *= 0x94d049bb133111ebULL;
+  x ^= x >> 31;
+  return x;
+}
+
+// The index-th key of an integer distribution. Indices [0, n) and [n, 2n)
+// give disjoint key sets, which the benchmarks use as hits and misses.
+inline std::uint64_t integer_key(KeyDistribution distribution, std::uint64_t index,
+                                 std::uint64_t seed = default_seed()) {
+  switch (distribution) {
+    case kRandomKeys:
+      return mix64(index ^ mix64(seed));
+    case kClusteredKeys:
+      return (mix64((index >> 6) ^ mix64(seed)) << 6) | (index & 63);
+    default:
+      return index;
+  }
+}
+
+inline std::vector<std::uint64_t> integer_keys(KeyDistribution distribution, std::uint64_t first, std::size_t count,
+                                               std::uint64_t seed = default_seed()) {
+  std::vector<std::uint64_t> keys(count);
+  for (std::size_t i = 0; i < count; ++i) {
+    keys[i] = integer_key(distribution, first + i, seed);
+  }
+  return keys;
+}
+
+// String keys with a shared prefix, as in path- or namespace-like identifiers
+// (long enough to defeat the small-string optimization)
+inline std::vector<std::string> string_keys(std::uint64_t first, std::size_t count,
+                                            std::uint64_t seed = default_seed()) {
+  std::vector<std::string> keys(count);
+  for (std::size_t i = 0; i < count; ++i) {
+    keys[i] = "user:" + std::to_string(integer_key(kRandomKeys, first + i, seed));
+  }
+  return keys;
+}
+
+// ---------------------------------------------------------------------------
+// Text
+// ---------------------------------------------------------------------------
+
+// count newline-terminated decimal numbers, as in one column of a CSV file.
+// Integers have 1 to 18 digits; floating-point values have 1 to 17
+// significant digits and exponents from -8 to 8, printed with %g so both
+// fixed and scientific notation appear. A quarter of the values are negative.
+inline std::string numeric_text(bool floating, std::size_t count, std::uint64_t seed = default_seed()) {
+  std::mt19937_64 gen(seed);
+  std::uniform_int_distribution<int> sign(0, 3);
+  std::uniform_int_distribution<int> digits(1, floating ? 17 : 18);
+  std::uniform_int_distribution<int> exponent(-8, 8);
+  std::uniform_real_distribution<double> mantissa(1.0, 10.0);
+  std::string text;
+  char buffer[32];
+  for (std::size_t i = 0; i < count; ++i) {
+    int length;
+    if (floating) {
+      double value = mantissa(gen) * std::pow(10.0, exponent(gen));
+      length = std::snprintf(buffer, sizeof(buffer), "%.*g", digits(gen), sign(gen) == 0 ? -value : value);
+    } else {
+      int width = digits(gen);
+      std::int64_t low = 1;
+      for (int d = 1; d < width; ++d) {
+        low *= 10;
+      }
+      std::int64_t value = std::uniform_int_distribution<std::int64_t>(width == 1 ? 0 : low, low * 10 - 1)(gen);
+      length = std::snprintf(buffer, sizeof(buffer), "%lld", static_cast<long long>(sign(gen) == 0 ? -value : value));
+    }
+    text.append(buffer, length);
+    text += '\n';
+  }
+  return text;
+}
+
+// Application log lines of at least the given total size. Each line has a
+// timestamp, level, service and a few message words; independently, one
+// line in eight carries each of an email address, a phone number, an IPv4
+// address and a session UUID, the personal data a log scrubber looks for.
+inline std::string log_text(std::size_t bytes, std::uint64_t seed = default_seed()) {
+  static const char* const levels[] = {"INFO", "WARN", "ERROR", "DEBUG"};
+  static const char* const services[] = {"auth", "billing", "search", "gateway"};
+  static const char* const words[] = {"request", "completed", "user", "session", "cache", "miss",
+                                      "retry", "timeout", "connection", "opened", "closed", "payload",
+                                      "accepted", "rejected", "queue", "flushed"};
+  std::mt19937_64 gen(seed);
+  std::uniform_int_distribution<int> pick(0, 15);
+  std::uniform_int_distribution<int> word_count(4, 8);
+  std::uniform_int_distribution<int> octet(0, 255);
+  std::uniform_int_distribution<int> digit(0, 9);
+  std::string text;
+  char buffer[64];
+  for (std::uint64_t line = 0; text.size() < bytes; ++line) {
+    std::snprintf(buffer, sizeof(buffer), "ts=%llu level=%s svc=%s msg=",
+                  static_cast<unsigned long long>(1700000000 + line), levels[pick(gen) % 4], services[pick(gen) % 4]);
+    text += buffer;
+    for (int w = word_count(gen); w > 0; --w) {
+      text += words[pick(gen)];
+      text += w > 1 ? '_' : ' ';
+    }
+    if (pick(gen) < 2) {
+      std::snprintf(buffer, sizeof(buffer), "email=%s.%s%d@example.com ", words[pick(gen)], words[pick(gen)], pick(gen));
+      text += buffer;
+    }
+    if (pick(gen) < 2) {
+      text += "phone=";
+      for (int d = 0; d < 10; ++d) {
+        text += static_cast<char>('0' + digit(gen));
+        if (d == 2 || d == 5) {
+          text += '-';
+        }
+      }
+      text += ' ';
+    }
+    if (pick(gen) < 2) {
+      std::snprintf(buffer, sizeof(buffer), "ip=%d.%d.%d.%d ", octet(gen), octet(gen), octet(gen), octet(gen));
+      text += buffer;
+    }
+    if (pick(gen) < 2) {
+      text += "session=";
+      for (int d = 0; d < 32; ++d) {
+        text += "0123456789abcdef"[pick(gen)];
+        if (d == 7 || d == 11 || d == 15 || d == 19) {
+          text += '-';
+        }
+      }
+    }
+    text += '\n';
+  }
+  return text;
+}
+
+// ---------------------------------------------------------------------------
+// Records
+// ---------------------------------------------------------------------------
+
+// count uniformly distributed indices in [0, bound)
+inline std::vector<int> random_indices(int count, int bound, std::uint64_t seed = default_seed()) {
+  std::mt19937 gen(static_cast<std::uint32_t>(seed));
+  std::uniform_int_distribution<> dist(0, bound - 1);
+  
+  std::vector<int> indices(count);
+  for (auto& index : indices) {
+    index = dist(gen);
+  }
+  return indices;
+}
+
+// Person records for the multi-index benchmarks. Person must be
+// constructible from (id, name, email, age, city).
+template <typename Person>
+std::vector<Person> generate_persons(int count) {
+  std::vector<Person> persons;
+  persons.reserve(count);
+  
+  static const char* const names[] = {"John", "Mary", "Steve", "Jane", "Michael", "Sarah", "Robert", "Emily", "William", "Olivia"};
+  static const char* const cities[] = {"New York", "London", "Paris", "Tokyo", "Berlin", "Sydney", "Moscow", "Beijing", "Mumbai", "Rio"};
+  
+  for (int i = 0; i < count; ++i) {
+    std::string name = names[i % 10];
+    std::string email = name + std::to_string(i) + "@example.com";
+    int age = 20 + (i % 60); // ages 20-79
+    std::string city = cities[i % 10];
+    
+    persons.emplace_back(i, name, email, age, city);
+  }
+  
+  return persons;
+}
+
+// ComplexData object with size values, size/2 properties, size/3 tags and
+// size/5 nested string lists, for the serialization benchmarks
+template <typename ComplexData>
+ComplexData generate_complex_data(int size) {
+  ComplexData data(1234, "TestObject");
+  
+  for (int i = 0; i < size; ++i) {
+    data.addValue(i * 3.14159);
+  }
+  for (int i = 0; i < size / 2; ++i) {
+    data.addProperty("prop_" + std::to_string(i), i * 10);
+  }
+  for (int i = 0; i < size / 3; ++i) {
+    data.addTag("tag_" + std::to_string(i));
+  }
+  for (int i = 0; i < size / 5; ++i) {
+    std::vector<std::string> strings;
+    for (int j = 0; j < 3; ++j) {
+      strings.push_back("nested_" + std::to_string(i) + "_" + std::to_string(j));
+    }
+    data.addNestedData(i, strings);
+  }
+  
+  return data;
+}
+
+} // namespace workloads
@@ -1,13 +1,36 @@
 #include <benchmark/benchmark.h>
 #include <boost/container/flat_map.hpp>
 #include <boost/container/vector.hpp>
+#include <boost/container/small_vector.hpp>
+#include <boost/container/static_vector.hpp>
+#include <boost/container/stable_vector.hpp>
+#include <boost/container/deque.hpp>
+#include <boost/version.hpp>
+#if BOOST_VERSION >= 107500
+#include <boost/container/devector.hpp>
+#endif
+#if BOOST_VERSION >= 108100
+#include <boost/unordered/unordered_flat_map.hpp>
+#include <boost/unordered/unordered_node_map.hpp>
+#endif
+#include "common/allocation_tracker.hpp"
+#include "common/allocators.hpp"
+#include "common/workloads.hpp"
 #include <vector>
 #include <map>
+#include <deque>
+#include <unordered_map>
+#include <string>
+#include <memory>
+#include <random>
+#include <algorithm>
+#include <cstdint>
 
 // Benchmark for boost::container::flat_map vs std::map
 static void BM_StdMap(benchmark::State& state) {
   const int SIZE = state.range(0);
   
+  allocations::Tracker allocation_tracker;
   for (auto _ : state) {
     std::map<int, int> m;
     for (int i = 0; i < SIZE; ++i) {
@@ -20,6 +43,7 @@ static void BM_StdMap(benchmark::State& state) {
     }
     benchmark::DoNotOptimize(sum);
   }
+  allocation_tracker.report(state);
   
   state.counters["Elements"] = SIZE;
 }
@@ -31,6 +55,7 @@ BENCHMARK(BM_StdMap)
 static void BM_BoostFlatMap(benchmark::State& state) {
   const int SIZE = state.range(0);
   
+  allocations::Tracker allocation_tracker;
   for (auto _ : state) {
     boost::container::flat_map<int, int> m;
     for (int i = 0; i < SIZE; ++i) {
@@ -43,6 +68,7 @@ static void BM_BoostFlatMap(benchmark::State& state) {
     }
     benchmark::DoNotOptimize(sum);
   }
+  allocation_tracker.report(state);
   
   state.counters["Elements"] = SIZE;
 }
@@ -51,10 +77,226 @@ BENCHMARK(BM_BoostFlatMap)
   ->Arg(1000)    // Medium map
   ->Arg(10000);  // Large map
 
+// The same map workloads with the allocation strategy as a template
+// parameter, to separate node and buffer allocation cost from the
+// container's own work
+template <typename Allocation>
+static void BM_StdMapAllocator(benchmark::State& state) {
+  const int SIZE = state.range(0);
+  typedef std::pair<const int, int> value_type;
+  
+  allocations::Tracker allocation_tracker;
+  for (auto _ : state) {
+    Allocation allocation;
+    std::map<int, int, std::less<int>, typename Allocation::template allocator<value_type>> m(
+      allocation.template get<value_type>());
+    for (int i = 0; i < SIZE; ++i) {
+      m[i] = i * 2;
+    }
+    
+    int sum = 0;
+    for (int i = 0; i < SIZE; ++i) {
+      sum += m[i];
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  allocators::report<Allocation>(allocation_tracker, state);
+  
+  state.counters["Elements"] = SIZE;
+}
+BENCHMARK_TEMPLATE(BM_StdMapAllocator, allocators::Std)
+  ->Arg(100)->Arg(1000)->Arg(10000);
+BENCHMARK_TEMPLATE(BM_StdMapAllocator, allocators::Monotonic)
+  ->Arg(100)->Arg(1000)->Arg(10000);
+BENCHMARK_TEMPLATE(BM_StdMapAllocator, allocators::UnsynchronizedPool)
+  ->Arg(100)->Arg(1000)->Arg(10000);
+BENCHMARK_TEMPLATE(BM_StdMapAllocator, allocators::AdaptivePool)
+  ->Arg(100)->Arg(1000)->Arg(10000);
+BENCHMARK_TEMPLATE(BM_StdMapAllocator, allocators::NodePool)
+  ->Arg(100)->Arg(1000)->Arg(10000);
+
+template <typename Allocation>
+static void BM_BoostFlatMapAllocator(benchmark::State& state) {
+  const int SIZE = state.range(0);
+  typedef std::pair<int, int> value_type;
+  
+  allocations::Tracker allocation_tracker;
+  for (auto _ : state) {
+    Allocation allocation;
+    boost::container::flat_map<int, int, std::less<int>, typename Allocation::template allocator<value_type>> m(
+      allocation.template get<value_type>());
+    for (int i = 0; i < SIZE; ++i) {
+      m[i] = i * 2;
+    }
+    
+    int sum = 0;
+    for (int i = 0; i < SIZE; ++i) {
+      sum += m[i];
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  allocators::report<Allocation>(allocation_tracker, state);
+  
+  state.counters["Elements"] = SIZE;
+}
+BENCHMARK_TEMPLATE(BM_BoostFlatMapAllocator, allocators::Std)
+  ->Arg(100)->Arg(1000)->Arg(10000);
+BENCHMARK_TEMPLATE(BM_BoostFlatMapAllocator, allocators::Monotonic)
+  ->Arg(100)->Arg(1000)->Arg(10000);
+BENCHMARK_TEMPLATE(BM_BoostFlatMapAllocator, allocators::UnsynchronizedPool)
+  ->Arg(100)->Arg(1000)->Arg(10000);
+BENCHMARK_TEMPLATE(BM_BoostFlatMapAllocator, allocators::AdaptivePool)
+  ->Arg(100)->Arg(1000)->Arg(10000);
+BENCHMARK_TEMPLATE(BM_BoostFlatMapAllocator, allocators::NodePool)
+  ->Arg(100)->Arg(1000)->Arg(10000);
+
+// Loading a batch of random keys into a flat_map that may already hold
+// data, four ways: one insert per element, unsorted range insert, range
+// insert of a pre-sorted batch tagged ordered_unique_range, and handing
+// the container a whole sequence via adopt_sequence. Args are
+// {batch size, elements already in the table}; existing keys and batch keys
+// are disjoint.
+typedef boost::container::flat_map<std::uint64_t, std::uint64_t> LookupTable;
+
+struct FlatMapBulkLoad {
+  LookupTable existing;
+  std::vector<std::pair<std::uint64_t, std::uint64_t>> batch;        // Random order
+  std::vector<std::pair<std::uint64_t, std::uint64_t>> sorted_batch; // Ascending keys
+  
+  FlatMapBulkLoad(std::size_t batch_size, std::size_t existing_size) {
+    auto existing_keys = workloads::integer_keys(workloads::kRandomKeys, 0, existing_size);
+    auto batch_keys = workloads::integer_keys(workloads::kRandomKeys, existing_size, batch_size);
+    std::vector<std::pair<std::uint64_t, std::uint64_t>> existing_elements;
+    for (std::size_t i = 0; i < existing_size; ++i) {
+      existing_elements.emplace_back(existing_keys[i], i);
+    }
+    existing.insert(existing_elements.begin(), existing_elements.end());
+    for (std::size_t i = 0; i < batch_size; ++i) {
+      batch.emplace_back(batch_keys[i], i);
+    }
+    sorted_batch = batch;
+    std::sort(sorted_batch.begin(), sorted_batch.end());
+  }
+};
+
+// Fresh copy of the existing table for one iteration, outside the timed region
+static LookupTable flat_map_load_target(benchmark::State& state, const FlatMapBulkLoad& load) {
+  state.PauseTiming();
+  LookupTable m = load.existing;
+  state.ResumeTiming();
+  return m;
+}
+
+static void set_flat_map_load_counters(benchmark::State& state, const FlatMapBulkLoad& load,
+                                       std::size_t loaded_size) {
+  if (loaded_size != load.existing.size() + load.batch.size()) {
+    state.SkipWithError("Loaded table has the wrong number of elements");
+    return;
+  }
+  state.counters["Elements"] = load.batch.size();
+  state.counters["ExistingElements"] = load.existing.size();
+  state.counters["ElementsPerSecond"] = benchmark::Counter(
+    static_cast<double>(load.batch.size()) * state.iterations(), benchmark::Counter::kIsRate);
+}
+
+static void BM_BoostFlatMapLoadPerElement(benchmark::State& state) {
+  FlatMapBulkLoad load(state.range(0), state.range(1));
+  
+  std::size_t loaded_size = 0;
+  for (auto _ : state) {
+    LookupTable m = flat_map_load_target(state, load);
+    for (const auto& element : load.batch) {
+      m.insert(element);
+    }
+    loaded_size = m.size();
+    benchmark::DoNotOptimize(m);
+  }
+  
+  set_flat_map_load_counters(state, load, loaded_size);
+}
+// Quadratic in the table size, so the largest loads are left to the bulk paths
+BENCHMARK(BM_BoostFlatMapLoadPerElement)
+  ->Args({1000, 0})        // Small batch into an empty table
+  ->Args({10000, 0})       // Medium batch into an empty table
+  ->Args({100000, 0})      // Large batch into an empty table
+  ->Args({10000, 100000})  // Incremental load into a populated table
+  ->Unit(benchmark::kMillisecond);
+
+static void BM_BoostFlatMapLoadUnsortedRange(benchmark::State& state) {
+  FlatMapBulkLoad load(state.range(0), state.range(1));
+  
+  std::size_t loaded_size = 0;
+  for (auto _ : state) {
+    LookupTable m = flat_map_load_target(state, load);
+    m.insert(load.batch.begin(), load.batch.end());
+    loaded_size = m.size();
+    benchmark::DoNotOptimize(m);
+  }
+  
+  set_flat_map_load_counters(state, load, loaded_size);
+}
+BENCHMARK(BM_BoostFlatMapLoadUnsortedRange)
+  ->Args({1000, 0})        // Small batch into an empty table
+  ->Args({10000, 0})       // Medium batch into an empty table
+  ->Args({100000, 0})      // Large batch into an empty table
+  ->Args({1000000, 0})     // Full table load
+  ->Args({10000, 100000})  // Incremental load into a populated table
+  ->Args({100000, 1000000})
+  ->Unit(benchmark::kMillisecond);
+
+static void BM_BoostFlatMapLoadOrderedRange(benchmark::State& state) {
+  FlatMapBulkLoad load(state.range(0), state.range(1));
+  
+  std::size_t loaded_size = 0;
+  for (auto _ : state) {
+    LookupTable m = flat_map_load_target(state, load);
+    m.insert(boost::container::ordered_unique_range, load.sorted_batch.begin(), load.sorted_batch.end());
+    loaded_size = m.size();
+    benchmark::DoNotOptimize(m);
+  }
+  
+  set_flat_map_load_counters(state, load, loaded_size);
+}
+BENCHMARK(BM_BoostFlatMapLoadOrderedRange)
+  ->Args({1000, 0})        // Small batch into an empty table
+  ->Args({10000, 0})       // Medium batch into an empty table
+  ->Args({100000, 0})      // Large batch into an empty table
+  ->Args({1000000, 0})     // Full table load
+  ->Args({10000, 100000})  // Incremental load into a populated table
+  ->Args({100000, 1000000})
+  ->Unit(benchmark::kMillisecond);
+
+// Append the unsorted batch to the table's own sequence and let
+// adopt_sequence sort and deduplicate the result
+static void BM_BoostFlatMapLoadAdoptSequence(benchmark::State& state) {
+  FlatMapBulkLoad load(state.range(0), state.range(1));
+  
+  std::size_t loaded_size = 0;
+  for (auto _ : state) {
+    LookupTable m = flat_map_load_target(state, load);
+    LookupTable::sequence_type sequence = m.extract_sequence();
+    sequence.insert(sequence.end(), load.batch.begin(), load.batch.end());
+    m.adopt_sequence(boost::move(sequence));
+    loaded_size = m.size();
+    benchmark::DoNotOptimize(m);
+  }
+  
+  set_flat_map_load_counters(state, load, loaded_size);
+}
+BENCHMARK(BM_BoostFlatMapLoadAdoptSequence)
+  ->Args({1000, 0})        // Small batch into an empty table
+  ->Args({10000, 0})       // Medium batch into an empty table
+  ->Args({100000, 0})      // Large batch into an empty table
+  ->Args({1000000, 0})     // Full table load
+  ->Args({10000, 100000})  // Incremental load into a populated table
+  ->Args({100000, 1000000})
+  ->Unit(benchmark::kMillisecond);
+
 // Benchmark for boost::container::vector vs std::vector
 static void BM_StdVector(benchmark::State& state) {
   const int SIZE = state.range(0);
   
+  allocations::Tracker allocation_tracker;
   for (auto _ : state) {
     std::vector<int> v;
     v.reserve(SIZE);
@@ -68,6 +310,7 @@ static void BM_StdVector(benchmark::State& state) {
     }
     benchmark::DoNotOptimize(sum);
   }
+  allocation_tracker.report(state);
   
   state.counters["Elements"] = SIZE;
 }
@@ -79,6 +322,7 @@ BENCHMARK(BM_StdVector)
 static void BM_BoostVector(benchmark::State& state) {
   const int SIZE = state.range(0);
   
+  allocations::Tracker allocation_tracker;
   for (auto _ : state) {
     boost::container::vector<int> v;
     v.reserve(SIZE);
@@ -92,6 +336,7 @@ static void BM_BoostVector(benchmark::State& state) {
     }
     benchmark::DoNotOptimize(sum);
   }
+  allocation_tracker.report(state);
   
   state.counters["Elements"] = SIZE;
 }
@@ -100,4 +345,433 @@ BENCHMARK(BM_BoostVector)
   ->Arg(10000)    // Medium vector
   ->Arg(100000);  // Large vector
 
+// Short sequences as built on request-handling hot paths: a handful of
+// elements pushed at the back, or alternately at the front and back, then
+// read once. Args are {element count, alternate push_front}; counts bracket
+// small_vector's inline capacity of 16. AllocationsAvoided is relative to
+// std::vector performing the same operations.
+
+template <typename T>
+using StdVectorOf = std::vector<T>;
+template <typename T>
+using SmallVectorOf = boost::container::small_vector<T, 16>;
+template <typename T>
+using StaticVectorOf = boost::container::static_vector<T, 64>;
+#if BOOST_VERSION >= 107500
+template <typename T>
+using DevectorOf = boost::container::devector<T>;
+#endif
+
+// Inserting at the front of a vector-like sequence shifts every element
+template <typename Sequence, typename T>
+static void push_front(Sequence& sequence, const T& value) {
+  sequence.insert(sequence.begin(), value);
+}
+
+#if BOOST_VERSION >= 107500
+template <typename T>
+static void push_front(boost::container::devector<T>& sequence, const T& value) {
+  sequence.push_front(value);
+}
+#endif
+
+static std::size_t element_weight(int value) { return value; }
+static std::size_t element_weight(const std::string& value) { return value.size(); }
+
+// Element values, built before timing. Strings fit the small-string buffer,
+// so copying them never allocates and only the sequence's own allocations
+// are counted.
+template <typename T>
+static std::vector<T> sequence_values(int count);
+
+template <>
+std::vector<int> sequence_values<int>(int count) {
+  std::vector<int> values(count);
+  for (int i = 0; i < count; ++i) {
+    values[i] = i;
+  }
+  return values;
+}
+
+template <>
+std::vector<std::string> sequence_values<std::string>(int count) {
+  std::vector<std::string> values(count);
+  for (int i = 0; i < count; ++i) {
+    values[i] = "item" + std::to_string(1000 + i);
+  }
+  return values;
+}
+
+template <typename Sequence, typename T>
+static std::size_t build_short_sequence(const std::vector<T>& values, bool mixed) {
+  Sequence sequence;
+  for (std::size_t i = 0; i < values.size(); ++i) {
+    if (mixed && (i & 1)) {
+      push_front(sequence, values[i]);
+    } else {
+      sequence.push_back(values[i]);
+    }
+  }
+  
+  std::size_t sum = 0;
+  for (const auto& element : sequence) {
+    sum += element_weight(element);
+  }
+  benchmark::DoNotOptimize(sequence.data());
+  return sum;
+}
+
+template <template <typename> class Sequence, typename T>
+static void BM_ShortSequence(benchmark::State& state) {
+  const int count = state.range(0);
+  const bool mixed = state.range(1) != 0;
+  auto values = sequence_values<T>(count);
+  
+  // Allocations std::vector needs for the same sequence
+  allocations::Totals baseline;
+  {
+    allocations::Tracker baseline_tracker;
+    build_short_sequence<std::vector<T>>(values, mixed);
+    baseline = baseline_tracker.stop();
+  }
+  
+  allocations::Tracker allocation_tracker;
+  for (auto _ : state) {
+    std::size_t sum = build_short_sequence<Sequence<T>>(values, mixed);
+    benchmark::DoNotOptimize(sum);
+  }
+  allocations::Totals totals = allocation_tracker.report(state);
+  
+  state.counters["Elements"] = count;
+  state.counters["AllocationsAvoided"] =
+    static_cast<double>(baseline.allocations) - static_cast<double>(totals.allocations) / state.iterations();
+}
+
+static void ShortSequenceArgs(benchmark::internal::Benchmark* b) {
+  for (int mixed : {0, 1}) {
+    for (int count : {4, 8, 15, 16, 17, 32, 64}) {
+      b->Args({count, mixed});
+    }
+  }
+}
+
+BENCHMARK_TEMPLATE(BM_ShortSequence, StdVectorOf, int)->Apply(ShortSequenceArgs);
+BENCHMARK_TEMPLATE(BM_ShortSequence, SmallVectorOf, int)->Apply(ShortSequenceArgs);
+BENCHMARK_TEMPLATE(BM_ShortSequence, StaticVectorOf, int)->Apply(ShortSequenceArgs);
+#if BOOST_VERSION >= 107500
+BENCHMARK_TEMPLATE(BM_ShortSequence, DevectorOf, int)->Apply(ShortSequenceArgs);
+#endif
+BENCHMARK_TEMPLATE(BM_ShortSequence, StdVectorOf, std::string)->Apply(ShortSequenceArgs);
+BENCHMARK_TEMPLATE(BM_ShortSequence, SmallVectorOf, std::string)->Apply(ShortSequenceArgs);
+BENCHMARK_TEMPLATE(BM_ShortSequence, StaticVectorOf, std::string)->Apply(ShortSequenceArgs);
+#if BOOST_VERSION >= 107500
+BENCHMARK_TEMPLATE(BM_ShortSequence, DevectorOf, std::string)->Apply(ShortSequenceArgs);
+#endif
+
+// Sequence containers with different memory layouts: contiguous
+// (std::vector), block lists (std::deque, boost::container::deque with
+// default, small and large blocks) and one node per element
+// (stable_vector). Sizes run from cache resident to well beyond the LLC.
+// Configure with -DBOOST_BENCH_PERF_COUNTERS=ON to see the cache misses
+// behind the pointer-chasing penalty.
+
+template <typename T>
+using StdDequeOf = std::deque<T>;
+template <typename T>
+using BoostDequeOf = boost::container::deque<T>;
+template <typename T>
+using BoostDeque64Of = boost::container::deque<
+  T, void, boost::container::deque_options_t<boost::container::block_size<64u>>>;
+template <typename T>
+using BoostDeque4096Of = boost::container::deque<
+  T, void, boost::container::deque_options_t<boost::container::block_size<4096u>>>;
+template <typename T>
+using StableVectorOf = boost::container::stable_vector<T>;
+
+enum SequenceOperation {
+  kSequenceIterate = 0, // Sum every element in order
+  kSequenceRandomRead,  // Sum elements at random positions
+  kSequenceMiddleInsert // Insert one element in the middle and erase it again
+};
+
+template <template <typename> class Sequence>
+static void BM_LargeSequence(benchmark::State& state) {
+  const std::size_t SIZE = state.range(0);
+  const int operation = state.range(1);
+  const std::size_t RANDOM_READS = 65536;
+  const int MIDDLE_INSERTS = 64;
+  
+  Sequence<std::uint64_t> sequence;
+  allocations::Totals footprint;
+  {
+    allocations::Tracker build_tracker;
+    for (std::size_t i = 0; i < SIZE; ++i) {
+      sequence.push_back(i);
+    }
+    footprint = build_tracker.stop();
+  }
+  
+  std::vector<std::size_t> positions;
+  for (auto index : workloads::integer_keys(workloads::kRandomKeys, 0, RANDOM_READS)) {
+    positions.push_back(index % SIZE);
+  }
+  
+  std::size_t operations = 0;
+  for (auto _ : state) {
+    std::uint64_t sum = 0;
+    switch (operation) {
+      case kSequenceIterate:
+        for (std::uint64_t value : sequence) {
+          sum += value;
+        }
+        operations = SIZE;
+        break;
+      case kSequenceRandomRead:
+        for (std::size_t position : positions) {
+          sum += sequence[position];
+        }
+        operations = positions.size();
+        break;
+      case kSequenceMiddleInsert:
+        for (int i = 0; i < MIDDLE_INSERTS; ++i) {
+          auto it = sequence.insert(sequence.begin() + SIZE / 2, i);
+          sum += *it;
+          sequence.erase(it);
+        }
+        operations = MIDDLE_INSERTS;
+        break;
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  
+  state.counters["Elements"] = SIZE;
+  state.counters["BytesPerElement"] = static_cast<double>(footprint.live_bytes) / SIZE;
+  state.counters["OperationsPerSecond"] = benchmark::Counter(
+    static_cast<double>(operations) * state.iterations(), benchmark::Counter::kIsRate);
+}
+
+// Arguments: {elements, operation}. 16M 8-byte elements are 128 MB in a
+// vector and several times that as stable_vector nodes.
+static void LargeSequenceArgs(benchmark::internal::Benchmark* b) {
+  for (int operation : {kSequenceIterate, kSequenceRandomRead, kSequenceMiddleInsert}) {
+    for (int size : {1 << 10, 1 << 20, 1 << 24}) {
+      b->Args({size, operation});
+    }
+  }
+}
+
+BENCHMARK_TEMPLATE(BM_LargeSequence, StdVectorOf)->Apply(LargeSequenceArgs)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(BM_LargeSequence, StdDequeOf)->Apply(LargeSequenceArgs)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(BM_LargeSequence, BoostDequeOf)->Apply(LargeSequenceArgs)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(BM_LargeSequence, BoostDeque64Of)->Apply(LargeSequenceArgs)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(BM_LargeSequence, BoostDeque4096Of)->Apply(LargeSequenceArgs)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(BM_LargeSequence, StableVectorOf)->Apply(LargeSequenceArgs)->Unit(benchmark::kMicrosecond);
+
+// Associative container matrix: container type x key distribution x
+// operation x size. Keys come from workloads::integer_keys/string_keys;
+// keys [0, n) are stored and keys [n, 2n) are guaranteed misses. Lookups and
+// erases visit keys in a shuffled order, so sequential keys are not also
+// accessed sequentially.
+
+template <typename Key, typename Value>
+using StdMap = std::map<Key, Value>;
+template <typename Key, typename Value>
+using StdUnorderedMap = std::unordered_map<Key, Value>;
+template <typename Key, typename Value>
+using FlatMap = boost::container::flat_map<Key, Value>;
+#if BOOST_VERSION >= 108100
+template <typename Key, typename Value>
+using UnorderedFlatMap = boost::unordered_flat_map<Key, Value>;
+template <typename Key, typename Value>
+using UnorderedNodeMap = boost::unordered_node_map<Key, Value>;
+#endif
+
+enum MapOperation {
+  kMapInsert = 0,   // Build the container one element at a time
+  kMapHitLookup,    // find() of stored keys
+  kMapMissLookup,   // find() of absent keys
+  kMapErase,        // Erase every key from a full (untimed) copy
+  kMapIterate       // Visit every element once
+};
+
+// Stored keys and miss keys for one distribution and size
+template <typename Key>
+struct MapKeys {
+  std::vector<Key> stored;
+  std::vector<Key> missing;
+  std::vector<Key> shuffled; // stored, in random order
+};
+
+template <typename Key>
+static std::vector<Key> map_keys(workloads::KeyDistribution distribution, std::uint64_t first, std::size_t count);
+
+template <>
+std::vector<std::uint64_t> map_keys<std::uint64_t>(workloads::KeyDistribution distribution, std::uint64_t first,
+                                                   std::size_t count) {
+  return workloads::integer_keys(distribution, first, count);
+}
+
+template <>
+std::vector<std::string> map_keys<std::string>(workloads::KeyDistribution, std::uint64_t first, std::size_t count) {
+  return workloads::string_keys(first, count);
+}
+
+// Generating 10M string keys takes seconds, so the most recent key set is
+// kept for the next benchmark with the same distribution and size
+template <typename Key>
+static const MapKeys<Key>& cached_map_keys(int distribution, std::size_t count) {
+  static std::unique_ptr<MapKeys<Key>> keys;
+  static std::pair<int, std::size_t> keys_params;
+  
+  std::pair<int, std::size_t> params(distribution, count);
+  if (!keys || keys_params != params) {
+    keys.reset();
+    keys.reset(new MapKeys<Key>);
+    keys_params = params;
+    
+    auto kind = static_cast<workloads::KeyDistribution>(distribution);
+    keys->stored = map_keys<Key>(kind, 0, count);
+    keys->missing = map_keys<Key>(kind, count, count);
+    keys->shuffled = keys->stored;
+    std::shuffle(keys->shuffled.begin(), keys->shuffled.end(), std::mt19937_64(workloads::default_seed()));
+  }
+  return *keys;
+}
+
+template <template <typename, typename> class Map, typename Key>
+static void BM_AssociativeMap(benchmark::State& state) {
+  typedef Map<Key, std::uint64_t> Container;
+  const int operation = state.range(1);
+  const std::size_t SIZE = state.range(2);
+  const MapKeys<Key>& keys = cached_map_keys<Key>(state.range(0), SIZE);
+  
+  // Built with one range insert: element-wise emplace of unsorted keys is
+  // quadratic on flat_map, and would dominate the 10M lookup rows' setup
+  Container full;
+  if (operation != kMapInsert) {
+    std::vector<std::pair<Key, std::uint64_t>> elements;
+    elements.reserve(SIZE);
+    for (std::size_t i = 0; i < SIZE; ++i) {
+      elements.emplace_back(keys.stored[i], i);
+    }
+    full.insert(elements.begin(), elements.end());
+  }
+  
+  // Erase passes copy the full map while timing is paused, but the tracker
+  // still sees the copy; measure one so it can be taken back out
+  allocations::Totals copy_totals{};
+  if (operation == kMapErase) {
+    allocations::Tracker copy_tracker;
+    Container m = full;
+    copy_totals = copy_tracker.stop();
+  }
+  
+  allocations::Tracker allocation_tracker;
+  for (auto _ : state) {
+    std::uint64_t sum = 0;
+    switch (operation) {
+      case kMapInsert: {
+        Container m;
+        for (std::size_t i = 0; i < SIZE; ++i) {
+          m.emplace(keys.stored[i], i);
+        }
+        sum = m.size();
+        break;
+      }
+      case kMapHitLookup:
+      case kMapMissLookup: {
+        const std::vector<Key>& probes = operation == kMapHitLookup ? keys.shuffled : keys.missing;
+        for (const Key& key : probes) {
+          auto it = full.find(key);
+          if (it != full.end()) {
+            sum += it->second;
+          }
+        }
+        break;
+      }
+      case kMapErase: {
+        state.PauseTiming();
+        Container m = full;
+        state.ResumeTiming();
+        for (const Key& key : keys.shuffled) {
+          sum += m.erase(key);
+        }
+        break;
+      }
+      case kMapIterate: {
+        for (const auto& element : full) {
+          sum += element.second;
+        }
+        break;
+      }
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  allocations::Totals totals = allocation_tracker.report(state);
+  if (operation == kMapErase) {
+    const double copies = static_cast<double>(state.iterations());
+    state.counters["AllocsPerIter"] = benchmark::Counter(
+      static_cast<double>(totals.allocations) - copies * copy_totals.allocations,
+      benchmark::Counter::kAvgIterations);
+    state.counters["BytesPerIter"] = benchmark::Counter(
+      static_cast<double>(totals.bytes) - copies * copy_totals.bytes,
+      benchmark::Counter::kAvgIterations, benchmark::Counter::OneK::kIs1024);
+    // The peak is the copy itself
+    state.counters.erase("PeakLiveBytes");
+  }
+  
+  state.counters["Elements"] = SIZE;
+  state.counters["Operations"] = benchmark::Counter(
+    static_cast<double>(SIZE) * state.iterations(), benchmark::Counter::kIsRate);
+}
+
+// Arguments for the matrix: {distribution, operation, size}. Per-element
+// insert and erase are O(n) on flat_map, so with QuadraticUpdates those
+// operations stop at 100k elements except for in-order insertion, which
+// appends.
+template <bool StringKeys, bool QuadraticUpdates>
+static void AssociativeMapArgs(benchmark::internal::Benchmark* b) {
+  std::vector<int> distributions;
+  if (StringKeys) {
+    distributions = {workloads::kStringKeys};
+  } else {
+    distributions = {workloads::kSequentialKeys, workloads::kRandomKeys, workloads::kClusteredKeys};
+  }
+  for (int distribution : distributions) {
+    for (int operation : {kMapInsert, kMapHitLookup, kMapMissLookup, kMapErase, kMapIterate}) {
+      for (int size : {1000, 100000, 10000000}) {
+        bool quadratic = operation == kMapErase ||
+                         (operation == kMapInsert && distribution != workloads::kSequentialKeys);
+        if (QuadraticUpdates && quadratic && size > 100000) {
+          continue;
+        }
+        b->Args({distribution, operation, size});
+      }
+    }
+  }
+}
+
+BENCHMARK_TEMPLATE(BM_AssociativeMap, StdMap, std::uint64_t)
+  ->Apply(AssociativeMapArgs<false, false>)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(BM_AssociativeMap, StdMap, std::string)
+  ->Apply(AssociativeMapArgs<true, false>)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(BM_AssociativeMap, StdUnorderedMap, std::uint64_t)
+  ->Apply(AssociativeMapArgs<false, false>)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(BM_AssociativeMap, StdUnorderedMap, std::string)
+  ->Apply(AssociativeMapArgs<true, false>)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(BM_AssociativeMap, FlatMap, std::uint64_t)
+  ->Apply(AssociativeMapArgs<false, true>)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(BM_AssociativeMap, FlatMap, std::string)
+  ->Apply(AssociativeMapArgs<true, true>)->Unit(benchmark::kMicrosecond);
+#if BOOST_VERSION >= 108100
+BENCHMARK_TEMPLATE(BM_AssociativeMap, UnorderedFlatMap, std::uint64_t)
+  ->Apply(AssociativeMapArgs<false, false>)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(BM_AssociativeMap, UnorderedFlatMap, std::string)
+  ->Apply(AssociativeMapArgs<true, false>)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(BM_AssociativeMap, UnorderedNodeMap, std::uint64_t)
+  ->Apply(AssociativeMapArgs<false, false>)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(BM_AssociativeMap, UnorderedNodeMap, std::string)
+  ->Apply(AssociativeMapArgs<true, false>)->Unit(benchmark::kMicrosecond);
+#endif
+
 BENCHMARK_MAIN();
\ No newline at end of file
@@ -4,57 +4,286 @@
 #include <boost/graph/breadth_first_search.hpp>
 #include <boost/graph/depth_first_search.hpp>
 #include <boost/graph/astar_search.hpp>
+#include <boost/graph/compressed_sparse_row_graph.hpp>
+#include <boost/graph/connected_components.hpp>
+#include <boost/graph/cuthill_mckee_ordering.hpp>
 #include <boost/graph/graph_traits.hpp>
+#include <boost/graph/detail/d_ary_heap.hpp>
+#include <boost/heap/fibonacci_heap.hpp>
+#include <boost/heap/pairing_heap.hpp>
 #include <boost/property_map/property_map.hpp>
+#include <boost/property_map/vector_property_map.hpp>
+#include <boost/pending/disjoint_sets.hpp>
+#include "common/workloads.hpp"
 #include <vector>
 #include <utility>
-#include <random>
+#include <map>
+#include <deque>
 #include <limits>
+#include <algorithm>
+#include <random>
+#include <cstdint>
+#include <chrono>
+#include <memory>
+#include <thread>
+#include <functional>
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <type_traits>
+#include <sys/resource.h>
 
-// Generate a random graph with given vertices and edges
+// Generate a random graph with given vertices and edges. The edge list comes
+// from the shared seeded generator, so every benchmark (and every run) sees
+// the same graph for the same parameters.
 template <typename Graph, typename WeightMap>
-void generate_random_graph(Graph& g, WeightMap weight_map, int num_vertices, int num_edges, int max_weight = 100) {
+void generate_random_graph(Graph& g, WeightMap weight_map, int num_vertices, int num_edges, int max_weight = 100,
+                           std::uint64_t seed = workloads::default_seed()) {
   // Add vertices
   for (int i = 0; i < num_vertices; ++i) {
     boost::add_vertex(g);
   }
   
-  // Random generator
-  std::random_device rd;
-  std::mt19937 gen(rd());
-  std::uniform_int_distribution<> vertex_dist(0, num_vertices - 1);
-  std::uniform_int_distribution<> weight_dist(1, max_weight);
+  // Add random edges (self-loops and duplicates already removed)
+  for (const auto& edge : workloads::random_edges(num_vertices, num_edges, max_weight,
+                                                  boost::is_undirected(g), seed)) {
+    typename boost::graph_traits<Graph>::edge_descriptor e;
+    bool inserted;
+    boost::tie(e, inserted) = boost::add_edge(edge.source, edge.target, g);
+    if (inserted) {
+      weight_map[e] = edge.weight;
+    }
+  }
+}
+
+// Bundled edge weight used by the compressed sparse row (CSR) graphs
+struct WeightedEdge {
+  int weight;
+};
+
+// Frozen CSR graph with 32-bit vertex and edge indices
+typedef boost::compressed_sparse_row_graph<
+  boost::directedS,
+  boost::no_property,           // Vertex properties
+  WeightedEdge,                 // Edge properties
+  boost::no_property,           // Graph properties
+  std::uint32_t,                // Vertex index type
+  std::uint32_t                 // Edge index type
+> CSRGraph;
+
+// Build a CSR graph from the edges of an already generated graph. Undirected
+// graphs contribute one directed CSR edge per direction, so traversals see
+// exactly the same neighborhoods as on the source graph.
+template <typename Graph, typename WeightMap>
+void build_csr_graph(CSRGraph& csr, const Graph& g, WeightMap weight_map) {
+  std::vector<std::pair<std::uint32_t, std::uint32_t>> edges;
+  std::vector<WeightedEdge> weights;
   
-  // Add random edges
-  for (int i = 0; i < num_edges; ++i) {
-    int source = vertex_dist(gen);
-    int target = vertex_dist(gen);
-    int weight = weight_dist(gen);
-    
-    // Skip self-loops
-    if (source != target) {
-      // Check if edge already exists
-      bool found = false;
-      typename boost::graph_traits<Graph>::out_edge_iterator ei, ei_end;
-      for (boost::tie(ei, ei_end) = boost::out_edges(source, g); ei != ei_end; ++ei) {
-        if (boost::target(*ei, g) == target) {
-          found = true;
-          break;
-        }
-      }
-      
-      if (!found) {
-        typename boost::graph_traits<Graph>::edge_descriptor e;
-        bool inserted;
-        boost::tie(e, inserted) = boost::add_edge(source, target, g);
-        if (inserted) {
-          weight_map[e] = weight;
-        }
+  typename boost::graph_traits<Graph>::vertex_iterator vi, vi_end;
+  for (boost::tie(vi, vi_end) = boost::vertices(g); vi != vi_end; ++vi) {
+    typename boost::graph_traits<Graph>::out_edge_iterator ei, ei_end;
+    for (boost::tie(ei, ei_end) = boost::out_edges(*vi, g); ei != ei_end; ++ei) {
+      edges.emplace_back(boost::source(*ei, g), boost::target(*ei, g));
+      weights.push_back(WeightedEdge{weight_map[*ei]});
+    }
+  }
+  
+  csr = CSRGraph(boost::edges_are_unsorted_multi_pass,
+                 edges.begin(), edges.end(), weights.begin(),
+                 boost::num_vertices(g));
+}
+
+// Bytes malloc reserves for one request: glibc chunks carry a size_t
+// header, are 16-byte aligned and at least 32 bytes
+inline double malloc_block_bytes(std::size_t size) {
+  std::size_t chunk = (size + sizeof(std::size_t) + 15) & ~std::size_t(15);
+  return chunk < 32 ? 32 : chunk;
+}
+
+// Property type a stored edge allocates separately on the heap, or void.
+// Directed adjacency_lists store out-edges as stored_edge_property, which
+// holds its property (even no_property) through a unique_ptr.
+template <typename StoredEdge>
+struct heap_edge_property {
+  typedef void type;
+};
+
+template <typename Vertex, typename Property>
+struct heap_edge_property<boost::detail::stored_edge_property<Vertex, Property>> {
+  typedef Property type;
+};
+
+// Approximate heap footprint of a vecS/vecS adjacency_list: the vertex array,
+// every per-vertex out-edge vector, the per-edge property allocations of
+// directed graphs and the list owning undirected edges
+template <typename Graph>
+double adjacency_list_bytes(const Graph& g) {
+  double bytes = g.m_vertices.capacity() * sizeof(typename Graph::stored_vertex);
+  for (const auto& v : g.m_vertices) {
+    bytes += v.m_out_edges.capacity() * sizeof(typename Graph::StoredEdge);
+  }
+  typedef typename heap_edge_property<typename Graph::StoredEdge>::type HeapProperty;
+  if constexpr (!std::is_void<HeapProperty>::value) {
+    bytes += boost::num_edges(g) * malloc_block_bytes(sizeof(HeapProperty));
+  }
+  // std::list node: payload plus next/prev pointers
+  bytes += g.m_edges.size() *
+    (sizeof(typename Graph::EdgeContainer::value_type) + 2 * sizeof(void*));
+  return bytes;
+}
+
+// Heap footprint of a CSR graph: row offsets, column indices and edge properties
+inline double csr_graph_bytes(const CSRGraph& g) {
+  return g.m_forward.m_rowstart.capacity() * sizeof(std::uint32_t) +
+         g.m_forward.m_column.capacity() * sizeof(std::uint32_t) +
+         boost::num_edges(g) * sizeof(WeightedEdge);
+}
+
+// Number of out-edges scanned by a full traversal from source: every vertex
+// reachable from source has all of its out-edges examined once
+template <typename Graph>
+double reachable_edge_count(const Graph& g,
+                            typename boost::graph_traits<Graph>::vertex_descriptor source) {
+  std::vector<bool> visited(boost::num_vertices(g), false);
+  std::vector<typename boost::graph_traits<Graph>::vertex_descriptor> stack(1, source);
+  visited[source] = true;
+  
+  double count = 0;
+  while (!stack.empty()) {
+    auto u = stack.back();
+    stack.pop_back();
+    typename boost::graph_traits<Graph>::out_edge_iterator ei, ei_end;
+    for (boost::tie(ei, ei_end) = boost::out_edges(u, g); ei != ei_end; ++ei) {
+      ++count;
+      auto v = boost::target(*ei, g);
+      if (!visited[v]) {
+        visited[v] = true;
+        stack.push_back(v);
       }
     }
   }
+  return count;
+}
+
+// Number of out-edges scanned by a partial traversal: every vertex the traversal
+// reached has all of its out-edges examined once
+template <typename Graph, typename ReachedPredicate>
+double traversed_edge_count(const Graph& g, ReachedPredicate reached) {
+  double count = 0;
+  typename boost::graph_traits<Graph>::vertex_iterator vi, vi_end;
+  for (boost::tie(vi, vi_end) = boost::vertices(g); vi != vi_end; ++vi) {
+    if (reached(*vi)) {
+      count += boost::out_degree(*vi, g);
+    }
+  }
+  return count;
 }
 
+// Bundled vertex position used by the grid graphs
+struct GridVertex {
+  std::pair<int, int> position;
+};
+
+// Property-map storage strategies for edge weights and vertex positions.
+// Graphs are always generated into std::map staging maps and then loaded
+// into the strategy's own layout, so every strategy searches the same kind
+// of input and only the property lookup differs.
+
+// Weights and positions in std::map behind associative_property_map
+// (every lookup is a red-black tree walk)
+template <typename DirectedS>
+struct AssociativePropertyStorage {
+  typedef boost::adjacency_list<boost::vecS, boost::vecS, DirectedS> Graph;
+  typedef typename boost::graph_traits<Graph>::vertex_descriptor Vertex;
+  typedef typename boost::graph_traits<Graph>::edge_descriptor Edge;
+  typedef boost::associative_property_map<std::map<Edge, int>> WeightMap;
+  typedef boost::associative_property_map<std::map<Vertex, std::pair<int, int>>> PositionMap;
+  
+  Graph g;
+  std::map<Edge, int> weights;
+  std::map<Vertex, std::pair<int, int>> positions;
+  
+  void load(std::map<Edge, int>& staged_weights,
+            std::map<Vertex, std::pair<int, int>>& staged_positions) {
+    weights.swap(staged_weights);
+    positions.swap(staged_positions);
+  }
+  
+  WeightMap weight_map() { return WeightMap(weights); }
+  PositionMap position_map() { return PositionMap(positions); }
+};
+
+// Weights and positions stored inline as bundled edge/vertex properties
+template <typename DirectedS>
+struct BundledPropertyStorage {
+  typedef boost::adjacency_list<boost::vecS, boost::vecS, DirectedS, GridVertex, WeightedEdge> Graph;
+  typedef typename boost::graph_traits<Graph>::vertex_descriptor Vertex;
+  typedef typename boost::graph_traits<Graph>::edge_descriptor Edge;
+  typedef typename boost::property_map<Graph, int WeightedEdge::*>::type WeightMap;
+  typedef typename boost::property_map<Graph, std::pair<int, int> GridVertex::*>::type PositionMap;
+  
+  Graph g;
+  
+  // Walk the graph's own edges: the staging map may still hold descriptors
+  // of edges the generator removed
+  void load(std::map<Edge, int>& staged_weights,
+            std::map<Vertex, std::pair<int, int>>& staged_positions) {
+    typename boost::graph_traits<Graph>::edge_iterator ei, ei_end;
+    for (boost::tie(ei, ei_end) = boost::edges(g); ei != ei_end; ++ei) {
+      g[*ei].weight = staged_weights[*ei];
+    }
+    for (const auto& entry : staged_positions) {
+      g[entry.first].position = entry.second;
+    }
+  }
+  
+  WeightMap weight_map() { return boost::get(&WeightedEdge::weight, g); }
+  PositionMap position_map() { return boost::get(&GridVertex::position, g); }
+};
+
+// Weights in a vector_property_map indexed by an interior edge_index
+// property, positions in a vector_property_map indexed by vertex_index
+template <typename DirectedS>
+struct EdgeIndexedPropertyStorage {
+  typedef boost::adjacency_list<
+    boost::vecS, boost::vecS, DirectedS,
+    boost::no_property,
+    boost::property<boost::edge_index_t, std::size_t>
+  > Graph;
+  typedef typename boost::graph_traits<Graph>::vertex_descriptor Vertex;
+  typedef typename boost::graph_traits<Graph>::edge_descriptor Edge;
+  typedef typename boost::property_map<Graph, boost::edge_index_t>::type EdgeIndexMap;
+  typedef typename boost::property_map<Graph, boost::vertex_index_t>::type VertexIndexMap;
+  typedef boost::vector_property_map<int, EdgeIndexMap> WeightMap;
+  typedef boost::vector_property_map<std::pair<int, int>, VertexIndexMap> PositionMap;
+  
+  Graph g;
+  WeightMap weights;
+  PositionMap positions;
+  
+  // Edge indices are assigned after generation so they stay dense even
+  // when the generator removes edges
+  void load(std::map<Edge, int>& staged_weights,
+            std::map<Vertex, std::pair<int, int>>& staged_positions) {
+    EdgeIndexMap edge_index = boost::get(boost::edge_index, g);
+    weights = WeightMap(boost::num_edges(g), edge_index);
+    positions = PositionMap(boost::num_vertices(g), boost::get(boost::vertex_index, g));
+    
+    std::size_t index = 0;
+    typename boost::graph_traits<Graph>::edge_iterator ei, ei_end;
+    for (boost::tie(ei, ei_end) = boost::edges(g); ei != ei_end; ++ei) {
+      boost::put(edge_index, *ei, index++);
+      weights[*ei] = staged_weights[*ei];
+    }
+    for (const auto& entry : staged_positions) {
+      positions[entry.first] = entry.second;
+    }
+  }
+  
+  WeightMap weight_map() { return weights; }
+  PositionMap position_map() { return positions; }
+};
+
 // Benchmark for Dijkstra's shortest path algorithm
 static void BM_BoostGraphDijkstra(benchmark::State& state) {
   // Graph parameters
@@ -109,136 +338,856 @@ static void BM_BoostGraphDijkstra(benchmark::State& state) {
   state.counters["Vertices"] = num_vertices;
   state.counters["Edges"] = num_edges;
   state.counters["EdgeDensity"] = static_cast<double>(num_edges) / num_vertices;
+  state.counters["BytesPerEdge"] = adjacency_list_bytes(g) / boost::num_edges(g);
+  state.counters["EdgesTraversed"] = benchmark::Counter(
+    reachable_edge_count(g, source) * state.iterations(), benchmark::Counter::kIsRate);
 }
 BENCHMARK(BM_BoostGraphDijkstra)
   ->Args({100, 5})     // Small graph (100 vertices, ~5 edges per vertex)
   ->Args({1000, 10})   // Medium graph (1000 vertices, ~10 edges per vertex)
   ->Args({5000, 20});  // Large graph (5000 vertices, ~20 edges per vertex)
 
-// A* heuristic for grid-based graphs
-template <typename Graph, typename PositionMap>
-class ManhattanDistanceHeuristic : public boost::astar_heuristic<Graph, int> {
-public:
-  typedef typename boost::graph_traits<Graph>::vertex_descriptor Vertex;
+// Dijkstra's shortest path on a frozen CSR copy of the same random graph
+static void BM_BoostGraphCSRDijkstra(benchmark::State& state) {
+  // Graph parameters
+  int num_vertices = state.range(0);
+  int num_edges = num_vertices * state.range(1); // Average number of edges per vertex
   
-  ManhattanDistanceHeuristic(Vertex goal, const PositionMap& pos_map)
-    : m_goal(goal), m_position_map(pos_map) {}
+  typedef boost::adjacency_list<
+    boost::vecS,                // OutEdgeList
+    boost::vecS,                // VertexList
+    boost::directedS,           // Directed graph
+    boost::no_property          // Vertex properties
+  > Graph;
   
-  int operator()(Vertex v) const {
-    std::pair<int, int> pos_v = m_position_map[v];
-    std::pair<int, int> pos_goal = m_position_map[m_goal];
+  typedef boost::graph_traits<Graph>::edge_descriptor Edge;
+  typedef boost::graph_traits<CSRGraph>::vertex_descriptor Vertex;
+  
+  // Generate the adjacency_list graph and freeze it into CSR form
+  Graph source_graph;
+  std::map<Edge, int> weights;
+  boost::associative_property_map<std::map<Edge, int>> weight_map(weights);
+  generate_random_graph(source_graph, weight_map, num_vertices, num_edges);
+  
+  CSRGraph g;
+  build_csr_graph(g, source_graph, weight_map);
+  
+  // Pick source vertex
+  Vertex source = 0;
+  
+  for (auto _ : state) {
+    // Vector for storing distances
+    std::vector<int> distances(num_vertices);
+    auto dist_map = boost::make_iterator_property_map(distances.begin(), boost::get(boost::vertex_index, g));
     
-    return std::abs(pos_v.first - pos_goal.first) +
-           std::abs(pos_v.second - pos_goal.second);
+    // Vector for predecessors
+    std::vector<Vertex> predecessors(num_vertices);
+    auto pred_map = boost::make_iterator_property_map(predecessors.begin(), boost::get(boost::vertex_index, g));
+    
+    // Run Dijkstra's algorithm
+    boost::dijkstra_shortest_paths(g, source,
+      boost::distance_map(dist_map).
+      predecessor_map(pred_map).
+      weight_map(boost::get(&WeightedEdge::weight, g)));
+    
+    benchmark::DoNotOptimize(distances);
+    benchmark::DoNotOptimize(predecessors);
   }
   
-private:
-  Vertex m_goal;
-  const PositionMap& m_position_map;
-};
+  state.counters["Vertices"] = num_vertices;
+  state.counters["Edges"] = num_edges;
+  state.counters["EdgeDensity"] = static_cast<double>(num_edges) / num_vertices;
+  state.counters["BytesPerEdge"] = csr_graph_bytes(g) / boost::num_edges(g);
+  state.counters["EdgesTraversed"] = benchmark::Counter(
+    reachable_edge_count(g, source) * state.iterations(), benchmark::Counter::kIsRate);
+}
+BENCHMARK(BM_BoostGraphCSRDijkstra)
+  ->Args({100, 5})     // Small graph (100 vertices, ~5 edges per vertex)
+  ->Args({1000, 10})   // Medium graph (1000 vertices, ~10 edges per vertex)
+  ->Args({5000, 20});  // Large graph (5000 vertices, ~20 edges per vertex)
 
-// Visitor for A* search termination
-template <typename Vertex>
-class AStarGoalVisitor : public boost::default_astar_visitor {
+// Dijkstra's shortest path with the edge weights held in each property-map
+// storage strategy
+template <typename Storage>
+static void BM_BoostGraphDijkstraWeightStorage(benchmark::State& state) {
+  // Graph parameters
+  int num_vertices = state.range(0);
+  int num_edges = num_vertices * state.range(1); // Average number of edges per vertex
+  
+  typedef typename Storage::Vertex Vertex;
+  typedef typename Storage::Edge Edge;
+  
+  // Generate graph into staging maps, then load the strategy's layout
+  Storage storage;
+  std::map<Edge, int> staged_weights;
+  std::map<Vertex, std::pair<int, int>> staged_positions;
+  generate_random_graph(storage.g, boost::make_assoc_property_map(staged_weights),
+                        num_vertices, num_edges);
+  storage.load(staged_weights, staged_positions);
+  
+  auto weight_map = storage.weight_map();
+  
+  // Pick source vertex
+  Vertex source = 0;
+  
+  for (auto _ : state) {
+    // Vector for storing distances
+    std::vector<int> distances(num_vertices);
+    auto dist_map = boost::make_iterator_property_map(distances.begin(), boost::get(boost::vertex_index, storage.g));
+    
+    // Vector for predecessors
+    std::vector<Vertex> predecessors(num_vertices);
+    auto pred_map = boost::make_iterator_property_map(predecessors.begin(), boost::get(boost::vertex_index, storage.g));
+    
+    // Run Dijkstra's algorithm
+    boost::dijkstra_shortest_paths(storage.g, source,
+      boost::distance_map(dist_map).
+      predecessor_map(pred_map).
+      weight_map(weight_map));
+    
+    benchmark::DoNotOptimize(distances);
+    benchmark::DoNotOptimize(predecessors);
+  }
+  
+  state.counters["Vertices"] = num_vertices;
+  state.counters["Edges"] = num_edges;
+  state.counters["EdgeDensity"] = static_cast<double>(num_edges) / num_vertices;
+  state.counters["EdgesTraversed"] = benchmark::Counter(
+    reachable_edge_count(storage.g, source) * state.iterations(), benchmark::Counter::kIsRate);
+}
+BENCHMARK_TEMPLATE(BM_BoostGraphDijkstraWeightStorage, AssociativePropertyStorage<boost::directedS>)
+  ->Args({1000, 10})   // Medium graph (1000 vertices, ~10 edges per vertex)
+  ->Args({5000, 20});  // Large graph (5000 vertices, ~20 edges per vertex)
+BENCHMARK_TEMPLATE(BM_BoostGraphDijkstraWeightStorage, BundledPropertyStorage<boost::directedS>)
+  ->Args({1000, 10})   // Medium graph (1000 vertices, ~10 edges per vertex)
+  ->Args({5000, 20});  // Large graph (5000 vertices, ~20 edges per vertex)
+BENCHMARK_TEMPLATE(BM_BoostGraphDijkstraWeightStorage, EdgeIndexedPropertyStorage<boost::directedS>)
+  ->Args({1000, 10})   // Medium graph (1000 vertices, ~10 edges per vertex)
+  ->Args({5000, 20});  // Large graph (5000 vertices, ~20 edges per vertex)
+
+// Priority queues for the pluggable Dijkstra loop below. Every queue is
+// constructed over the distance buffer and offers push(v, key),
+// decrease(v, key), pop(v, key) and empty(). Vertices are vecS indices.
+typedef std::size_t QueueVertex;
+
+// boost::d_ary_heap_indirect keyed by the distance buffer, as used by
+// boost::dijkstra_shortest_paths (which defaults to Arity = 4)
+template <std::size_t Arity>
+class DAryHeapQueue {
 public:
-  AStarGoalVisitor(Vertex goal) : m_goal(goal) {}
+  explicit DAryHeapQueue(std::vector<int>& distances)
+    : m_distances(distances),
+      m_index_in_heap(distances.size(), std::size_t(-1)),
+      m_heap(boost::make_iterator_property_map(distances.begin(), boost::identity_property_map()),
+             boost::make_iterator_property_map(m_index_in_heap.begin(), boost::identity_property_map())) {}
   
-  template <typename Graph>
-  void examine_vertex(Vertex u, const Graph&) {
-    if (u == m_goal) {
-      throw std::runtime_error("Goal reached");
-    }
+  void push(QueueVertex v, int) { m_heap.push(v); }
+  void decrease(QueueVertex v, int) { m_heap.update(v); }
+  void pop(QueueVertex& v, int& key) {
+    v = m_heap.top();
+    key = m_distances[v];
+    m_heap.pop();
   }
+  bool empty() const { return m_heap.empty(); }
   
 private:
-  Vertex m_goal;
+  typedef boost::iterator_property_map<std::vector<int>::iterator, boost::identity_property_map> KeyMap;
+  typedef boost::iterator_property_map<std::vector<std::size_t>::iterator, boost::identity_property_map> IndexMap;
+  
+  std::vector<int>& m_distances;
+  std::vector<std::size_t> m_index_in_heap;
+  boost::d_ary_heap_indirect<QueueVertex, Arity, IndexMap, KeyMap, std::less<int>> m_heap;
 };
 
-// Generate a grid graph for A* search
-template <typename Graph, typename PositionMap, typename WeightMap>
-void generate_grid_graph(Graph& g, PositionMap pos_map, WeightMap weight_map, int width, int height) {
-  typedef typename boost::graph_traits<Graph>::vertex_descriptor Vertex;
-  typedef typename boost::graph_traits<Graph>::edge_descriptor Edge;
+// Monotone radix heap (Ahuja et al.) for small non-negative integer keys.
+// Popped keys never decrease, so an entry lives in the bucket given by the
+// bit width of (key XOR last popped key) and a pop only redistributes the
+// lowest non-empty bucket. Decrease-key re-inserts the vertex; the stale
+// entry is skipped by the Dijkstra loop's distance check.
+class RadixHeapQueue {
+public:
+  explicit RadixHeapQueue(std::vector<int>&) {}
   
-  // Create vertices representing grid points
-  std::vector<Vertex> vertices(width * height);
-  for (int y = 0; y < height; ++y) {
-    for (int x = 0; x < width; ++x) {
-      Vertex v = boost::add_vertex(g);
-      pos_map[v] = std::make_pair(x, y);
-      vertices[y * width + x] = v;
-    }
+  void push(QueueVertex v, int key) {
+    m_buckets[bucket(key)].emplace_back(key, v);
+    ++m_size;
   }
-  
-  // Add edges between adjacent grid points
-  for (int y = 0; y < height; ++y) {
-    for (int x = 0; x < width; ++x) {
-      Vertex current = vertices[y * width + x];
-      
-      // Connect to neighbors (4-way connectivity)
-      // Right neighbor
-      if (x + 1 < width) {
-        Vertex right = vertices[y * width + (x + 1)];
-        Edge e;
-        bool inserted;
-        boost::tie(e, inserted) = boost::add_edge(current, right, g);
-        if (inserted) {
-          // Add weight (can be based on some terrain cost)
-          weight_map[e] = 1;
-        }
-      }
-      
-      // Down neighbor
-      if (y + 1 < height) {
-        Vertex down = vertices[(y + 1) * width + x];
-        Edge e;
-        bool inserted;
-        boost::tie(e, inserted) = boost::add_edge(current, down, g);
-        if (inserted) {
-          weight_map[e] = 1;
-        }
+  void decrease(QueueVertex v, int key) { push(v, key); }
+  void pop(QueueVertex& v, int& key) {
+    if (m_buckets[0].empty()) {
+      std::size_t i = 1;
+      while (m_buckets[i].empty()) {
+        ++i;
       }
-      
-      // Add diagonal neighbors for more complex paths
-      // Down-right neighbor
-      if (x + 1 < width && y + 1 < height) {
-        Vertex down_right = vertices[(y + 1) * width + (x + 1)];
-        Edge e;
-        bool inserted;
-        boost::tie(e, inserted) = boost::add_edge(current, down_right, g);
-        if (inserted) {
-          // Diagonal has slightly higher weight
-          weight_map[e] = 14; // ~sqrt(2) * 10
-        }
-      }
-      
-      // Down-left neighbor
-      if (x > 0 && y + 1 < height) {
-        Vertex down_left = vertices[(y + 1) * width + (x - 1)];
-        Edge e;
-        bool inserted;
-        boost::tie(e, inserted) = boost::add_edge(current, down_left, g);
-        if (inserted) {
-          weight_map[e] = 14; // ~sqrt(2) * 10
-        }
+      m_last = std::min_element(m_buckets[i].begin(), m_buckets[i].end())->first;
+      for (const auto& entry : m_buckets[i]) {
+        m_buckets[bucket(entry.first)].push_back(entry);
       }
+      m_buckets[i].clear();
     }
+    key = m_buckets[0].back().first;
+    v = m_buckets[0].back().second;
+    m_buckets[0].pop_back();
+    --m_size;
   }
+  bool empty() const { return m_size == 0; }
   
-  // Add some random obstacles (by removing edges)
-  std::random_device rd;
-  std::mt19937 gen(rd());
-  std::uniform_int_distribution<> vertex_dist(0, width * height - 1);
-  
-  int num_obstacles = (width * height) / 10; // 10% obstacles
-  for (int i = 0; i < num_obstacles; ++i) {
-    int idx = vertex_dist(gen);
-    Vertex v = vertices[idx];
-    
-    // Remove all edges connected to this vertex
-    boost::clear_vertex(v, g);
+private:
+  std::size_t bucket(int key) const {
+    return key == m_last ? 0 : 32 - __builtin_clz(static_cast<unsigned>(key ^ m_last));
   }
-}
+  
+  std::vector<std::pair<int, QueueVertex>> m_buckets[33];
+  int m_last = 0;
+  std::size_t m_size = 0;
+};
+
+// Boost.Heap node-based heap with handles for decrease-key
+struct HeapEntry {
+  int key;
+  QueueVertex vertex;
+};
+
+struct HeapEntryGreater {
+  bool operator()(const HeapEntry& a, const HeapEntry& b) const { return a.key > b.key; }
+};
+
+template <typename Heap>
+class BoostHeapQueue {
+public:
+  explicit BoostHeapQueue(std::vector<int>& distances) : m_handles(distances.size()) {}
+  
+  void push(QueueVertex v, int key) { m_handles[v] = m_heap.push(HeapEntry{key, v}); }
+  // A smaller distance is a higher priority under HeapEntryGreater
+  void decrease(QueueVertex v, int key) { m_heap.increase(m_handles[v], HeapEntry{key, v}); }
+  void pop(QueueVertex& v, int& key) {
+    key = m_heap.top().key;
+    v = m_heap.top().vertex;
+    m_heap.pop();
+  }
+  bool empty() const { return m_heap.empty(); }
+  
+private:
+  Heap m_heap;
+  std::vector<typename Heap::handle_type> m_handles;
+};
+
+typedef BoostHeapQueue<boost::heap::pairing_heap<HeapEntry, boost::heap::compare<HeapEntryGreater>>> PairingHeapQueue;
+typedef BoostHeapQueue<boost::heap::fibonacci_heap<HeapEntry, boost::heap::compare<HeapEntryGreater>>> FibonacciHeapQueue;
+
+// Queue operation counts of one Dijkstra query
+struct DijkstraQueueStats {
+  double relaxations = 0;   // Edges scanned
+  double pushes = 0;
+  double decrease_keys = 0;
+};
+
+// Dijkstra's algorithm with the priority queue as a template parameter.
+// Vertices are pushed on first discovery and decreased on every later
+// improvement; pops with a key above the vertex's distance are stale
+// entries of lazy queues and are skipped.
+template <typename Queue, typename Graph, typename WeightMap>
+void dijkstra_with_queue(const Graph& g, WeightMap weight_map, QueueVertex source,
+                         std::vector<int>& distances, DijkstraQueueStats& stats) {
+  const int infinity = std::numeric_limits<int>::max();
+  std::fill(distances.begin(), distances.end(), infinity);
+  stats = DijkstraQueueStats();
+  
+  Queue queue(distances);
+  distances[source] = 0;
+  queue.push(source, 0);
+  ++stats.pushes;
+  
+  while (!queue.empty()) {
+    QueueVertex u;
+    int du;
+    queue.pop(u, du);
+    if (du > distances[u]) {
+      continue;
+    }
+    
+    typename boost::graph_traits<Graph>::out_edge_iterator ei, ei_end;
+    for (boost::tie(ei, ei_end) = boost::out_edges(u, g); ei != ei_end; ++ei) {
+      ++stats.relaxations;
+      QueueVertex v = boost::target(*ei, g);
+      int distance = du + boost::get(weight_map, *ei);
+      if (distance < distances[v]) {
+        bool queued = distances[v] != infinity;
+        distances[v] = distance;
+        if (queued) {
+          queue.decrease(v, distance);
+          ++stats.decrease_keys;
+        } else {
+          queue.push(v, distance);
+          ++stats.pushes;
+        }
+      }
+    }
+  }
+}
+
+// Dijkstra's shortest path with each priority queue, validated against
+// boost::dijkstra_shortest_paths
+template <typename Queue>
+static void BM_BoostGraphDijkstraQueue(benchmark::State& state) {
+  // Graph parameters
+  int num_vertices = state.range(0);
+  int num_edges = num_vertices * state.range(1); // Average number of edges per vertex
+  
+  typedef BundledPropertyStorage<boost::directedS> Storage;
+  typedef Storage::Vertex Vertex;
+  typedef Storage::Edge Edge;
+  
+  // Generate graph (weights 1..100)
+  Storage storage;
+  std::map<Edge, int> staged_weights;
+  std::map<Vertex, std::pair<int, int>> staged_positions;
+  generate_random_graph(storage.g, boost::make_assoc_property_map(staged_weights),
+                        num_vertices, num_edges);
+  storage.load(staged_weights, staged_positions);
+  
+  const Storage::Graph& g = storage.g;
+  auto weight_map = storage.weight_map();
+  
+  // Pick source vertex
+  Vertex source = 0;
+  
+  std::vector<int> distances(num_vertices);
+  DijkstraQueueStats stats;
+  
+  // Validate against Boost's Dijkstra
+  std::vector<int> reference(num_vertices);
+  boost::dijkstra_shortest_paths(g, source,
+    boost::distance_map(boost::make_iterator_property_map(reference.begin(), boost::get(boost::vertex_index, g))).
+    weight_map(weight_map));
+  dijkstra_with_queue<Queue>(g, weight_map, source, distances, stats);
+  if (distances != reference) {
+    state.SkipWithError("Distances do not match boost::dijkstra_shortest_paths");
+    return;
+  }
+  
+  for (auto _ : state) {
+    dijkstra_with_queue<Queue>(g, weight_map, source, distances, stats);
+    benchmark::DoNotOptimize(distances.data());
+  }
+  
+  state.counters["Vertices"] = num_vertices;
+  state.counters["Edges"] = num_edges;
+  state.counters["Relaxations"] = stats.relaxations;
+  state.counters["Pushes"] = stats.pushes;
+  state.counters["DecreaseKeys"] = stats.decrease_keys;
+  state.counters["TimePerRelaxation"] = benchmark::Counter(
+    stats.relaxations * state.iterations(), benchmark::Counter::kIsRate | benchmark::Counter::kInvert);
+}
+BENCHMARK_TEMPLATE(BM_BoostGraphDijkstraQueue, DAryHeapQueue<2>)
+  ->Args({5000, 20})     // Large graph (5000 vertices, ~20 edges per vertex)
+  ->Args({100000, 8});   // Sparse graph beyond L2 (100000 vertices, ~8 edges per vertex)
+BENCHMARK_TEMPLATE(BM_BoostGraphDijkstraQueue, DAryHeapQueue<4>)
+  ->Args({5000, 20})     // Large graph (5000 vertices, ~20 edges per vertex)
+  ->Args({100000, 8});   // Sparse graph beyond L2 (100000 vertices, ~8 edges per vertex)
+BENCHMARK_TEMPLATE(BM_BoostGraphDijkstraQueue, DAryHeapQueue<8>)
+  ->Args({5000, 20})     // Large graph (5000 vertices, ~20 edges per vertex)
+  ->Args({100000, 8});   // Sparse graph beyond L2 (100000 vertices, ~8 edges per vertex)
+BENCHMARK_TEMPLATE(BM_BoostGraphDijkstraQueue, RadixHeapQueue)
+  ->Args({5000, 20})     // Large graph (5000 vertices, ~20 edges per vertex)
+  ->Args({100000, 8});   // Sparse graph beyond L2 (100000 vertices, ~8 edges per vertex)
+BENCHMARK_TEMPLATE(BM_BoostGraphDijkstraQueue, PairingHeapQueue)
+  ->Args({5000, 20})     // Large graph (5000 vertices, ~20 edges per vertex)
+  ->Args({100000, 8});   // Sparse graph beyond L2 (100000 vertices, ~8 edges per vertex)
+BENCHMARK_TEMPLATE(BM_BoostGraphDijkstraQueue, FibonacciHeapQueue)
+  ->Args({5000, 20})     // Large graph (5000 vertices, ~20 edges per vertex)
+  ->Args({100000, 8});   // Sparse graph beyond L2 (100000 vertices, ~8 edges per vertex)
+
+// Thread counts for the multi-threaded benchmarks: powers of two up to the
+// number of hardware threads, plus the hardware thread count itself
+static void HardwareThreadCounts(benchmark::internal::Benchmark* b) {
+  int max_threads = std::max(1u, std::thread::hardware_concurrency());
+  for (int threads = 1; threads < max_threads; threads *= 2) {
+    b->Threads(threads);
+  }
+  b->Threads(max_threads);
+}
+
+// Batch of independent Dijkstra queries from different sources over one
+// shared read-only graph. Sources are sharded round-robin across the
+// benchmark threads and every thread reuses its own distance/predecessor
+// buffers, so one iteration is one query.
+
+// One query from source into caller-owned buffers
+template <typename Graph, typename Vertex>
+static void multi_source_query(const Graph& g, Vertex source, std::vector<int>& distances,
+                               std::vector<Vertex>& predecessors) {
+  auto dist_map = boost::make_iterator_property_map(distances.begin(), boost::get(boost::vertex_index, g));
+  auto pred_map = boost::make_iterator_property_map(predecessors.begin(), boost::get(boost::vertex_index, g));
+  
+  boost::dijkstra_shortest_paths(g, source,
+    boost::distance_map(dist_map).
+    predecessor_map(pred_map).
+    weight_map(boost::get(&WeightedEdge::weight, g)));
+  
+  benchmark::DoNotOptimize(distances.data());
+  benchmark::DoNotOptimize(predecessors.data());
+}
+
+static void BM_BoostGraphDijkstraMultiSource(benchmark::State& state) {
+  // Graph parameters
+  int num_vertices = state.range(0);
+  int num_edges = num_vertices * state.range(1); // Average number of edges per vertex
+  const int BASELINE_QUERIES = 16;
+  
+  typedef BundledPropertyStorage<boost::directedS> Storage;
+  typedef Storage::Vertex Vertex;
+  typedef Storage::Edge Edge;
+  
+  // Shared graph, (re)built by the first thread only when the parameters
+  // change. The barrier at the start of the timed loop publishes it to the
+  // other threads.
+  static std::unique_ptr<Storage> shared;
+  static std::pair<int, int> shared_params;
+  // Single-thread query rate on the shared graph, the baseline for
+  // ScalingEfficiency. Timed alongside the build, so every row has it
+  // regardless of filter, order or repetitions.
+  static double single_thread_rate;
+  
+  std::pair<int, int> params(num_vertices, num_edges);
+  if (state.thread_index() == 0 && (!shared || shared_params != params)) {
+    shared.reset(new Storage);
+    shared_params = params;
+    std::map<Edge, int> staged_weights;
+    std::map<Vertex, std::pair<int, int>> staged_positions;
+    generate_random_graph(shared->g, boost::make_assoc_property_map(staged_weights),
+                          num_vertices, num_edges);
+    shared->load(staged_weights, staged_positions);
+    
+    std::vector<int> distances(num_vertices);
+    std::vector<Vertex> predecessors(num_vertices);
+    multi_source_query(shared->g, Vertex(0), distances, predecessors); // Warm-up
+    auto start = std::chrono::steady_clock::now();
+    for (int query = 0; query < BASELINE_QUERIES; ++query) {
+      multi_source_query(shared->g, Vertex(query % num_vertices), distances, predecessors);
+    }
+    double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    single_thread_rate = BASELINE_QUERIES / elapsed;
+  }
+  
+  // Per-thread buffers reused by every query
+  std::vector<int> distances(num_vertices);
+  std::vector<Vertex> predecessors(num_vertices);
+  
+  // Shard sources round-robin: thread t handles t, t + threads, ...
+  Vertex source = state.thread_index();
+  const Vertex stride = state.threads();
+  
+  auto start = std::chrono::steady_clock::now();
+  for (auto _ : state) {
+    multi_source_query(shared->g, source, distances, predecessors);
+    source = (source + stride) % num_vertices;
+  }
+  double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  
+  state.counters["Queries"] = benchmark::Counter(state.iterations(), benchmark::Counter::kIsRate);
+  state.counters["QueriesPerThread"] = benchmark::Counter(state.iterations(), benchmark::Counter::kAvgThreadsRate);
+  
+  if (state.thread_index() == 0) {
+    state.counters["Vertices"] = num_vertices;
+    state.counters["Edges"] = num_edges;
+    
+    // Aggregate rate relative to perfect linear scaling of the 1-thread rate
+    double rate = static_cast<double>(state.iterations()) * state.threads() / elapsed;
+    state.counters["ScalingEfficiency"] = rate / (single_thread_rate * state.threads());
+  }
+}
+BENCHMARK(BM_BoostGraphDijkstraMultiSource)
+  ->Args({5000, 20})     // Large graph (5000 vertices, ~20 edges per vertex)
+  ->Args({50000, 10})    // Road-like graph (50000 vertices, ~10 edges per vertex)
+  ->Apply(HardwareThreadCounts)
+  ->UseRealTime();
+
+// Minimal fork-join pool: run(task) calls task(thread_id) on every thread,
+// with the caller acting as thread 0, and returns once all calls finished.
+// Workers persist across calls, so a parallel phase costs two handoffs
+// rather than a thread start.
+class ForkJoinPool {
+public:
+  explicit ForkJoinPool(int num_threads) : m_num_threads(num_threads) {
+    for (int id = 1; id < num_threads; ++id) {
+      m_workers.emplace_back([this, id] { worker(id); });
+    }
+  }
+  
+  ~ForkJoinPool() {
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_stop = true;
+    }
+    m_start.notify_all();
+    for (auto& worker : m_workers) {
+      worker.join();
+    }
+  }
+  
+  int size() const { return m_num_threads; }
+  
+  void run(const std::function<void(int)>& task) {
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_task = &task;
+      m_pending = m_num_threads - 1;
+      ++m_generation;
+    }
+    m_start.notify_all();
+    task(0);
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_done.wait(lock, [this] { return m_pending == 0; });
+  }
+  
+private:
+  void worker(int id) {
+    std::size_t seen = 0;
+    for (;;) {
+      const std::function<void(int)>* task;
+      {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_start.wait(lock, [&] { return m_stop || m_generation != seen; });
+        if (m_stop) {
+          return;
+        }
+        seen = m_generation;
+        task = m_task;
+      }
+      (*task)(id);
+      {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        --m_pending;
+      }
+      m_done.notify_one();
+    }
+  }
+  
+  int m_num_threads;
+  std::vector<std::thread> m_workers;
+  std::mutex m_mutex;
+  std::condition_variable m_start;
+  std::condition_variable m_done;
+  const std::function<void(int)>* m_task = nullptr;
+  std::size_t m_generation = 0;
+  int m_pending = 0;
+  bool m_stop = false;
+};
+
+// Parallel delta-stepping single-source shortest paths (bucket-synchronous,
+// in the style of the GAP benchmark suite). Vertices are kept in buckets of
+// width delta; each phase relaxes all out-edges of the current bucket in
+// parallel with an atomic min on the distance, and improved vertices go to
+// thread-local buckets that are merged into the next frontier. A vertex whose
+// distance already fell below the current bucket was settled earlier and is
+// skipped. Buffers are allocated once and reused by every query.
+template <typename Graph, typename WeightMap>
+class DeltaSteppingSSSP {
+public:
+  typedef typename boost::graph_traits<Graph>::vertex_descriptor Vertex;
+  
+  DeltaSteppingSSSP(const Graph& g, WeightMap weight_map, int delta, ForkJoinPool& pool)
+    : m_graph(g), m_weight_map(weight_map), m_delta(delta), m_pool(pool),
+      m_distances(new std::atomic<int>[boost::num_vertices(g)]),
+      m_local_bins(pool.size()) {}
+  
+  void run(Vertex source) {
+    const std::size_t n = boost::num_vertices(m_graph);
+    for (std::size_t v = 0; v < n; ++v) {
+      m_distances[v].store(std::numeric_limits<int>::max(), std::memory_order_relaxed);
+    }
+    m_distances[source].store(0, std::memory_order_relaxed);
+    m_frontier.assign(1, source);
+    m_phases = 0;
+    
+    std::size_t current_bin = 0;
+    const std::function<void(int)> relax_frontier = [&](int thread_id) {
+      auto& bins = m_local_bins[thread_id];
+      const std::size_t chunk = (m_frontier.size() + m_pool.size() - 1) / m_pool.size();
+      const std::size_t begin = std::min(m_frontier.size(), thread_id * chunk);
+      const std::size_t end = std::min(m_frontier.size(), begin + chunk);
+      
+      for (std::size_t i = begin; i < end; ++i) {
+        Vertex u = m_frontier[i];
+        int du = m_distances[u].load(std::memory_order_relaxed);
+        if (static_cast<std::size_t>(du) < current_bin * m_delta) {
+          continue; // Settled in an earlier bucket
+        }
+        typename boost::graph_traits<Graph>::out_edge_iterator ei, ei_end;
+        for (boost::tie(ei, ei_end) = boost::out_edges(u, m_graph); ei != ei_end; ++ei) {
+          Vertex v = boost::target(*ei, m_graph);
+          int distance = du + boost::get(m_weight_map, *ei);
+          int old = m_distances[v].load(std::memory_order_relaxed);
+          while (distance < old) {
+            if (m_distances[v].compare_exchange_weak(old, distance, std::memory_order_relaxed)) {
+              std::size_t bin = distance / m_delta;
+              if (bin >= bins.size()) {
+                bins.resize(bin + 1);
+              }
+              bins[bin].push_back(v);
+              break;
+            }
+          }
+        }
+      }
+    };
+    
+    while (!m_frontier.empty()) {
+      m_pool.run(relax_frontier);
+      ++m_phases;
+      
+      // Next bucket: the lowest non-empty one, which may be the current one
+      // again when light edges refilled it
+      std::size_t next_bin = std::numeric_limits<std::size_t>::max();
+      for (const auto& bins : m_local_bins) {
+        for (std::size_t bin = current_bin; bin < bins.size() && bin < next_bin; ++bin) {
+          if (!bins[bin].empty()) {
+            next_bin = bin;
+            break;
+          }
+        }
+      }
+      
+      m_frontier.clear();
+      if (next_bin == std::numeric_limits<std::size_t>::max()) {
+        break;
+      }
+      for (auto& bins : m_local_bins) {
+        if (next_bin < bins.size()) {
+          m_frontier.insert(m_frontier.end(), bins[next_bin].begin(), bins[next_bin].end());
+          bins[next_bin].clear();
+        }
+      }
+      current_bin = next_bin;
+    }
+  }
+  
+  int distance(Vertex v) const { return m_distances[v].load(std::memory_order_relaxed); }
+  int phases() const { return m_phases; }
+  
+private:
+  const Graph& m_graph;
+  WeightMap m_weight_map;
+  std::size_t m_delta;
+  ForkJoinPool& m_pool;
+  std::unique_ptr<std::atomic<int>[]> m_distances;
+  std::vector<Vertex> m_frontier;
+  std::vector<std::vector<std::vector<Vertex>>> m_local_bins; // [thread][bucket]
+  int m_phases = 0;
+};
+
+// Average wall-clock seconds of one boost::dijkstra_shortest_paths query,
+// the baseline for the delta-stepping speedup
+template <typename Graph, typename WeightMap>
+double dijkstra_seconds(const Graph& g, WeightMap weight_map,
+                        typename boost::graph_traits<Graph>::vertex_descriptor source,
+                        std::vector<int>& distances) {
+  const int runs = 3;
+  auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < runs; ++i) {
+    boost::dijkstra_shortest_paths(g, source,
+      boost::distance_map(boost::make_iterator_property_map(distances.begin(), boost::get(boost::vertex_index, g))).
+      weight_map(weight_map));
+  }
+  return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count() / runs;
+}
+
+// Arguments for the delta-stepping benchmark:
+// {vertices, edges per vertex, bucket width, threads}
+static void DeltaSteppingArgs(benchmark::internal::Benchmark* b) {
+  int max_threads = std::max(1u, std::thread::hardware_concurrency());
+  std::vector<int> thread_counts;
+  for (int threads = 1; threads < max_threads; threads *= 2) {
+    thread_counts.push_back(threads);
+  }
+  thread_counts.push_back(max_threads);
+  
+  for (int delta : {1, 25, 100}) {      // Weights are 1..100
+    for (int threads : thread_counts) {
+      b->Args({100000, 4, delta, threads}); // Road-like graph (low degree)
+    }
+  }
+}
+
+// Parallel delta-stepping SSSP on the same weighted random graph as
+// BM_BoostGraphDijkstra, validated against boost::dijkstra_shortest_paths
+static void BM_BoostGraphDeltaStepping(benchmark::State& state) {
+  // Graph parameters
+  int num_vertices = state.range(0);
+  int num_edges = num_vertices * state.range(1); // Average number of edges per vertex
+  int delta = state.range(2);
+  int num_threads = state.range(3);
+  
+  typedef BundledPropertyStorage<boost::directedS> Storage;
+  typedef Storage::Vertex Vertex;
+  typedef Storage::Edge Edge;
+  
+  // Generate graph
+  Storage storage;
+  std::map<Edge, int> staged_weights;
+  std::map<Vertex, std::pair<int, int>> staged_positions;
+  generate_random_graph(storage.g, boost::make_assoc_property_map(staged_weights),
+                        num_vertices, num_edges);
+  storage.load(staged_weights, staged_positions);
+  
+  const Storage::Graph& g = storage.g;
+  auto weight_map = storage.weight_map();
+  
+  // Pick source vertex
+  Vertex source = 0;
+  
+  ForkJoinPool pool(num_threads);
+  DeltaSteppingSSSP<Storage::Graph, Storage::WeightMap> sssp(g, weight_map, delta, pool);
+  
+  // Validate against Dijkstra, which also provides the speedup baseline
+  std::vector<int> reference(num_vertices);
+  double baseline_seconds = dijkstra_seconds(g, weight_map, source, reference);
+  sssp.run(source);
+  for (int v = 0; v < num_vertices; ++v) {
+    if (sssp.distance(v) != reference[v]) {
+      state.SkipWithError("Delta-stepping distances do not match boost::dijkstra_shortest_paths");
+      return;
+    }
+  }
+  
+  auto start = std::chrono::steady_clock::now();
+  for (auto _ : state) {
+    sssp.run(source);
+    benchmark::ClobberMemory();
+  }
+  double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  
+  state.counters["Vertices"] = num_vertices;
+  state.counters["Edges"] = num_edges;
+  state.counters["Delta"] = delta;
+  state.counters["Threads"] = num_threads;
+  state.counters["Phases"] = sssp.phases();
+  state.counters["SpeedupVsDijkstra"] = baseline_seconds / (elapsed / state.iterations());
+}
+BENCHMARK(BM_BoostGraphDeltaStepping)
+  ->Apply(DeltaSteppingArgs)
+  ->UseRealTime();
+
+// A* heuristic for grid-based graphs
+template <typename Graph, typename PositionMap>
+class ManhattanDistanceHeuristic : public boost::astar_heuristic<Graph, int> {
+public:
+  typedef typename boost::graph_traits<Graph>::vertex_descriptor Vertex;
+  
+  ManhattanDistanceHeuristic(Vertex goal, const PositionMap& pos_map)
+    : m_goal(goal), m_position_map(pos_map) {}
+  
+  int operator()(Vertex v) const {
+    std::pair<int, int> pos_v = m_position_map[v];
+    std::pair<int, int> pos_goal = m_position_map[m_goal];
+    
+    return std::abs(pos_v.first - pos_goal.first) +
+           std::abs(pos_v.second - pos_goal.second);
+  }
+  
+private:
+  Vertex m_goal;
+  const PositionMap& m_position_map;
+};
+
+// Visitor for A* search termination
+template <typename Vertex>
+class AStarGoalVisitor : public boost::default_astar_visitor {
+public:
+  AStarGoalVisitor(Vertex goal) : m_goal(goal) {}
+  
+  template <typename Graph>
+  void examine_vertex(Vertex u, const Graph&) {
+    if (u == m_goal) {
+      throw std::runtime_error("Goal reached");
+    }
+  }
+  
+private:
+  Vertex m_goal;
+};
+
+// Generate a grid graph for A* search
+template <typename Graph, typename PositionMap, typename WeightMap>
+void generate_grid_graph(Graph& g, PositionMap pos_map, WeightMap weight_map, int width, int height,
+                         std::uint64_t seed = workloads::default_seed()) {
+  typedef typename boost::graph_traits<Graph>::vertex_descriptor Vertex;
+  typedef typename boost::graph_traits<Graph>::edge_descriptor Edge;
+  
+  // Create vertices representing grid points
+  std::vector<Vertex> vertices(width * height);
+  for (int y = 0; y < height; ++y) {
+    for (int x = 0; x < width; ++x) {
+      Vertex v = boost::add_vertex(g);
+      pos_map[v] = std::make_pair(x, y);
+      vertices[y * width + x] = v;
+    }
+  }
+  
+  // Add edges between adjacent grid points
+  for (int y = 0; y < height; ++y) {
+    for (int x = 0; x < width; ++x) {
+      Vertex current = vertices[y * width + x];
+      
+      // Connect to neighbors (4-way connectivity)
+      // Right neighbor
+      if (x + 1 < width) {
+        Vertex right = vertices[y * width + (x + 1)];
+        Edge e;
+        bool inserted;
+        boost::tie(e, inserted) = boost::add_edge(current, right, g);
+        if (inserted) {
+          // Add weight (can be based on some terrain cost)
+          weight_map[e] = 1;
+        }
+      }
+      
+      // Down neighbor
+      if (y + 1 < height) {
+        Vertex down = vertices[(y + 1) * width + x];
+        Edge e;
+        bool inserted;
+        boost::tie(e, inserted) = boost::add_edge(current, down, g);
+        if (inserted) {
+          weight_map[e] = 1;
+        }
+      }
+      
+      // Add diagonal neighbors for more complex paths
+      // Down-right neighbor
+      if (x + 1 < width && y + 1 < height) {
+        Vertex down_right = vertices[(y + 1) * width + (x + 1)];
+        Edge e;
+        bool inserted;
+        boost::tie(e, inserted) = boost::add_edge(current, down_right, g);
+        if (inserted) {
+          // Diagonal has slightly higher weight
+          weight_map[e] = 14; // ~sqrt(2) * 10
+        }
+      }
+      
+      // Down-left neighbor
+      if (x > 0 && y + 1 < height) {
+        Vertex down_left = vertices[(y + 1) * width + (x - 1)];
+        Edge e;
+        bool inserted;
+        boost::tie(e, inserted) = boost::add_edge(current, down_left, g);
+        if (inserted) {
+          weight_map[e] = 14; // ~sqrt(2) * 10
+        }
+      }
+    }
+  }
+  
+  // Add some random obstacles (by removing edges), 10% of the cells
+  for (int idx : workloads::grid_obstacles(width, height, seed)) {
+    Vertex v = vertices[idx];
+    
+    // Remove all edges connected to this vertex
+    boost::clear_vertex(v, g);
+  }
+}
 
 // Benchmark for A* search algorithm
 static void BM_BoostGraphAStar(benchmark::State& state) {
@@ -288,13 +1237,186 @@ static void BM_BoostGraphAStar(benchmark::State& state) {
     // Initialize start vertex
     distances[start] = 0;
     
-    // Create heuristic functor
-    ManhattanDistanceHeuristic<Graph, boost::associative_property_map<std::map<Vertex, std::pair<int, int>>>> 
-      heuristic(goal, pos_map);
-    
-    // Create visitor
-    AStarGoalVisitor<Vertex> visitor(goal);
-    
+    // Create heuristic functor
+    ManhattanDistanceHeuristic<Graph, boost::associative_property_map<std::map<Vertex, std::pair<int, int>>>> 
+      heuristic(goal, pos_map);
+    
+    // Create visitor
+    AStarGoalVisitor<Vertex> visitor(goal);
+    
+    try {
+      // Run A* search
+      boost::astar_search(g, start, heuristic,
+        boost::predecessor_map(pred_map).
+        distance_map(dist_map).
+        weight_map(weight_map).
+        visitor(visitor).
+        rank_map(cost_map).
+        color_map(color_map));
+    }
+    catch (std::runtime_error&) {
+      // Goal was found
+    }
+    
+    benchmark::DoNotOptimize(distances);
+    benchmark::DoNotOptimize(predecessors);
+  }
+  
+  state.counters["GridSize"] = width * height;
+  state.counters["Width"] = width;
+  state.counters["Height"] = height;
+}
+BENCHMARK(BM_BoostGraphAStar)
+  ->Arg(20)    // Small grid (20x20)
+  ->Arg(50)    // Medium grid (50x50)
+  ->Arg(100);  // Large grid (100x100)
+
+// A* search on a frozen CSR copy of the grid. The grid is generated and frozen
+// once, so only the search itself is timed.
+static void BM_BoostGraphCSRAStar(benchmark::State& state) {
+  // Grid parameters
+  int width = state.range(0);
+  int height = state.range(0); // Square grid
+  
+  typedef boost::adjacency_list<
+    boost::vecS,
+    boost::vecS,
+    boost::bidirectionalS
+  > Graph;
+  
+  typedef boost::graph_traits<Graph>::edge_descriptor Edge;
+  typedef boost::graph_traits<CSRGraph>::vertex_descriptor Vertex;
+  
+  // Generate the grid graph and freeze it into CSR form
+  Graph grid;
+  std::map<boost::graph_traits<Graph>::vertex_descriptor, std::pair<int, int>> grid_positions;
+  std::map<Edge, int> weights;
+  boost::associative_property_map<std::map<boost::graph_traits<Graph>::vertex_descriptor, std::pair<int, int>>>
+    grid_pos_map(grid_positions);
+  boost::associative_property_map<std::map<Edge, int>> weight_map(weights);
+  generate_grid_graph(grid, grid_pos_map, weight_map, width, height);
+  
+  CSRGraph g;
+  build_csr_graph(g, grid, weight_map);
+  
+  // Vertex-indexed positions for the heuristic
+  std::vector<std::pair<int, int>> positions(boost::num_vertices(g));
+  for (std::size_t v = 0; v < positions.size(); ++v) {
+    positions[v] = grid_positions[v];
+  }
+  auto pos_map = boost::make_iterator_property_map(positions.begin(), boost::get(boost::vertex_index, g));
+  
+  // Choose source and target vertices (opposite corners)
+  Vertex start = 0; // Top-left
+  Vertex goal = boost::num_vertices(g) - 1; // Bottom-right
+  
+  ManhattanDistanceHeuristic<CSRGraph, decltype(pos_map)> heuristic(goal, pos_map);
+  AStarGoalVisitor<Vertex> visitor(goal);
+  
+  double edges_per_search = 0;
+  
+  for (auto _ : state) {
+    // Prepare data structures for A* search
+    std::vector<Vertex> predecessors(boost::num_vertices(g));
+    std::vector<int> distances(boost::num_vertices(g), std::numeric_limits<int>::max());
+    std::vector<int> costs(boost::num_vertices(g));
+    std::vector<boost::default_color_type> colors(boost::num_vertices(g));
+    
+    // Property maps
+    auto pred_map = boost::make_iterator_property_map(predecessors.begin(), boost::get(boost::vertex_index, g));
+    auto dist_map = boost::make_iterator_property_map(distances.begin(), boost::get(boost::vertex_index, g));
+    auto cost_map = boost::make_iterator_property_map(costs.begin(), boost::get(boost::vertex_index, g));
+    auto color_map = boost::make_iterator_property_map(colors.begin(), boost::get(boost::vertex_index, g));
+    
+    // Initialize start vertex
+    distances[start] = 0;
+    
+    try {
+      // Run A* search
+      boost::astar_search(g, start, heuristic,
+        boost::predecessor_map(pred_map).
+        distance_map(dist_map).
+        weight_map(boost::get(&WeightedEdge::weight, g)).
+        visitor(visitor).
+        rank_map(cost_map).
+        color_map(color_map));
+    }
+    catch (std::runtime_error&) {
+      // Goal was found
+    }
+    
+    benchmark::DoNotOptimize(distances);
+    benchmark::DoNotOptimize(predecessors);
+    
+    if (edges_per_search == 0) {
+      // Every closed (black) vertex had all of its out-edges examined
+      state.PauseTiming();
+      edges_per_search = traversed_edge_count(g, [&](Vertex v) {
+        return colors[v] == boost::black_color;
+      });
+      state.ResumeTiming();
+    }
+  }
+  
+  state.counters["GridSize"] = width * height;
+  state.counters["Width"] = width;
+  state.counters["Height"] = height;
+  state.counters["BytesPerEdge"] = csr_graph_bytes(g) / boost::num_edges(g);
+  state.counters["EdgesTraversed"] = benchmark::Counter(
+    edges_per_search * state.iterations(), benchmark::Counter::kIsRate);
+}
+BENCHMARK(BM_BoostGraphCSRAStar)
+  ->Arg(20)    // Small grid (20x20)
+  ->Arg(50)    // Medium grid (50x50)
+  ->Arg(100);  // Large grid (100x100)
+
+// A* search with weights and positions held in each property-map storage
+// strategy. The grid is generated once, so only the search itself is timed.
+template <typename Storage>
+static void BM_BoostGraphAStarPropertyStorage(benchmark::State& state) {
+  // Grid parameters
+  int width = state.range(0);
+  int height = state.range(0); // Square grid
+  
+  typedef typename Storage::Vertex Vertex;
+  typedef typename Storage::Edge Edge;
+  typedef typename Storage::Graph Graph;
+  
+  // Generate grid into staging maps, then load the strategy's layout
+  Storage storage;
+  std::map<Edge, int> staged_weights;
+  std::map<Vertex, std::pair<int, int>> staged_positions;
+  generate_grid_graph(storage.g, boost::make_assoc_property_map(staged_positions),
+                      boost::make_assoc_property_map(staged_weights), width, height);
+  storage.load(staged_weights, staged_positions);
+  
+  const Graph& g = storage.g;
+  auto weight_map = storage.weight_map();
+  auto pos_map = storage.position_map();
+  
+  // Choose source and target vertices (opposite corners)
+  Vertex start = 0; // Top-left
+  Vertex goal = boost::num_vertices(g) - 1; // Bottom-right
+  
+  ManhattanDistanceHeuristic<Graph, decltype(pos_map)> heuristic(goal, pos_map);
+  AStarGoalVisitor<Vertex> visitor(goal);
+  
+  for (auto _ : state) {
+    // Prepare data structures for A* search
+    std::vector<Vertex> predecessors(boost::num_vertices(g));
+    std::vector<int> distances(boost::num_vertices(g), std::numeric_limits<int>::max());
+    std::vector<int> costs(boost::num_vertices(g));
+    std::vector<boost::default_color_type> colors(boost::num_vertices(g));
+    
+    // Property maps
+    auto pred_map = boost::make_iterator_property_map(predecessors.begin(), boost::get(boost::vertex_index, g));
+    auto dist_map = boost::make_iterator_property_map(distances.begin(), boost::get(boost::vertex_index, g));
+    auto cost_map = boost::make_iterator_property_map(costs.begin(), boost::get(boost::vertex_index, g));
+    auto color_map = boost::make_iterator_property_map(colors.begin(), boost::get(boost::vertex_index, g));
+    
+    // Initialize start vertex
+    distances[start] = 0;
+    
     try {
       // Run A* search
       boost::astar_search(g, start, heuristic,
@@ -317,7 +1439,168 @@ static void BM_BoostGraphAStar(benchmark::State& state) {
   state.counters["Width"] = width;
   state.counters["Height"] = height;
 }
-BENCHMARK(BM_BoostGraphAStar)
+BENCHMARK_TEMPLATE(BM_BoostGraphAStarPropertyStorage, AssociativePropertyStorage<boost::bidirectionalS>)
+  ->Arg(50)    // Medium grid (50x50)
+  ->Arg(100);  // Large grid (100x100)
+BENCHMARK_TEMPLATE(BM_BoostGraphAStarPropertyStorage, BundledPropertyStorage<boost::bidirectionalS>)
+  ->Arg(50)    // Medium grid (50x50)
+  ->Arg(100);  // Large grid (100x100)
+BENCHMARK_TEMPLATE(BM_BoostGraphAStarPropertyStorage, EdgeIndexedPropertyStorage<boost::bidirectionalS>)
+  ->Arg(50)    // Medium grid (50x50)
+  ->Arg(100);  // Large grid (100x100)
+
+// Reusable A* search over a vertex-indexed graph. This is a hand-written A*
+// over Boost.Graph's traversal interface, not boost::astar_search: Boost's
+// A* can only stop at the goal by throwing from a visitor, and it allocates
+// its queue and maps on every call. All buffers here are allocated once;
+// each query resets only the vertices the previous one touched and returns
+// as soon as the goal is closed. The open set is a binary heap with lazy
+// deletion: improved vertices are pushed again and stale entries are
+// skipped when popped.
+template <typename Graph>
+class AStarSearchState {
+public:
+  typedef typename boost::graph_traits<Graph>::vertex_descriptor Vertex;
+  
+  explicit AStarSearchState(std::size_t num_vertices)
+    : m_distances(num_vertices, std::numeric_limits<int>::max()),
+      m_predecessors(num_vertices),
+      m_colors(num_vertices, boost::white_color) {
+    m_touched.reserve(num_vertices);
+    m_open.reserve(num_vertices);
+  }
+  
+  // Returns true if goal is reachable from start
+  template <typename WeightMap, typename Heuristic>
+  bool search(const Graph& g, Vertex start, Vertex goal, WeightMap weight_map, const Heuristic& heuristic) {
+    reset();
+    m_expanded = 0;
+    
+    relax(start, start, 0, heuristic);
+    while (!m_open.empty()) {
+      std::pop_heap(m_open.begin(), m_open.end(), std::greater<OpenEntry>());
+      OpenEntry entry = m_open.back();
+      m_open.pop_back();
+      
+      Vertex u = entry.vertex;
+      if (entry.distance > m_distances[u]) {
+        continue; // Superseded by a shorter path
+      }
+      m_colors[u] = boost::black_color;
+      ++m_expanded;
+      if (u == goal) {
+        return true;
+      }
+      
+      typename boost::graph_traits<Graph>::out_edge_iterator ei, ei_end;
+      for (boost::tie(ei, ei_end) = boost::out_edges(u, g); ei != ei_end; ++ei) {
+        Vertex v = boost::target(*ei, g);
+        int distance = m_distances[u] + boost::get(weight_map, *ei);
+        if (distance < m_distances[v]) {
+          relax(v, u, distance, heuristic);
+        }
+      }
+    }
+    return false;
+  }
+  
+  int distance(Vertex v) const { return m_distances[v]; }
+  Vertex predecessor(Vertex v) const { return m_predecessors[v]; }
+  std::size_t expanded() const { return m_expanded; }
+  
+private:
+  struct OpenEntry {
+    int rank;     // distance + heuristic
+    int distance; // distance when pushed, to detect stale entries
+    Vertex vertex;
+    
+    bool operator>(const OpenEntry& other) const { return rank > other.rank; }
+  };
+  
+  template <typename Heuristic>
+  void relax(Vertex v, Vertex predecessor, int distance, const Heuristic& heuristic) {
+    if (m_colors[v] == boost::white_color) {
+      m_touched.push_back(v);
+    }
+    m_distances[v] = distance;
+    m_predecessors[v] = predecessor;
+    m_colors[v] = boost::gray_color;
+    m_open.push_back(OpenEntry{distance + heuristic(v), distance, v});
+    std::push_heap(m_open.begin(), m_open.end(), std::greater<OpenEntry>());
+  }
+  
+  void reset() {
+    for (Vertex v : m_touched) {
+      m_distances[v] = std::numeric_limits<int>::max();
+      m_colors[v] = boost::white_color;
+    }
+    m_touched.clear();
+    m_open.clear();
+  }
+  
+  std::vector<int> m_distances;
+  std::vector<Vertex> m_predecessors;
+  std::vector<boost::default_color_type> m_colors;
+  std::vector<Vertex> m_touched;
+  std::vector<OpenEntry> m_open;
+  std::size_t m_expanded = 0;
+};
+
+// Pathfinding latency with the grid built once, search buffers reused across
+// queries and early exit without exception unwinding. Runs the hand-written
+// AStarSearchState rather than boost::astar_search, checked once against
+// boost::dijkstra_shortest_paths.
+static void BM_BoostGraphAStarReusable(benchmark::State& state) {
+  // Grid parameters
+  int width = state.range(0);
+  int height = state.range(0); // Square grid
+  
+  typedef BundledPropertyStorage<boost::bidirectionalS> Storage;
+  typedef Storage::Graph Graph;
+  typedef Storage::Vertex Vertex;
+  typedef Storage::Edge Edge;
+  
+  // Generate grid once
+  Storage storage;
+  std::map<Edge, int> staged_weights;
+  std::map<Vertex, std::pair<int, int>> staged_positions;
+  generate_grid_graph(storage.g, boost::make_assoc_property_map(staged_positions),
+                      boost::make_assoc_property_map(staged_weights), width, height);
+  storage.load(staged_weights, staged_positions);
+  
+  const Graph& g = storage.g;
+  auto weight_map = storage.weight_map();
+  auto pos_map = storage.position_map();
+  
+  // Choose source and target vertices (opposite corners)
+  Vertex start = 0; // Top-left
+  Vertex goal = boost::num_vertices(g) - 1; // Bottom-right
+  
+  ManhattanDistanceHeuristic<Graph, decltype(pos_map)> heuristic(goal, pos_map);
+  AStarSearchState<Graph> search(boost::num_vertices(g));
+  
+  // Validate the early-exit search against Dijkstra's distance to the goal
+  std::vector<int> reference(boost::num_vertices(g));
+  boost::dijkstra_shortest_paths(g, start,
+    boost::distance_map(boost::make_iterator_property_map(reference.begin(), boost::get(boost::vertex_index, g))).
+    weight_map(weight_map));
+  search.search(g, start, goal, weight_map, heuristic);
+  if (search.distance(goal) != reference[goal]) {
+    state.SkipWithError("A* distance does not match Dijkstra");
+    return;
+  }
+  
+  for (auto _ : state) {
+    bool found = search.search(g, start, goal, weight_map, heuristic);
+    benchmark::DoNotOptimize(found);
+  }
+  
+  state.counters["GridSize"] = width * height;
+  state.counters["Width"] = width;
+  state.counters["Height"] = height;
+  state.counters["ExpandedVertices"] = search.expanded();
+}
+BENCHMARK(BM_BoostGraphAStarReusable)
   ->Arg(20)    // Small grid (20x20)
   ->Arg(50)    // Medium grid (50x50)
   ->Arg(100);  // Large grid (100x100)
@@ -375,40 +1658,358 @@ static void BM_BoostGraphBFS(benchmark::State& state) {
       )
     );
     
-    benchmark::DoNotOptimize(distances);
-    benchmark::DoNotOptimize(predecessors);
+    benchmark::DoNotOptimize(distances);
+    benchmark::DoNotOptimize(predecessors);
+  }
+  
+  state.counters["Vertices"] = num_vertices;
+  state.counters["Edges"] = num_edges;
+  state.counters["EdgeDensity"] = static_cast<double>(num_edges) / num_vertices;
+  state.counters["BytesPerEdge"] = adjacency_list_bytes(g) / boost::num_edges(g);
+  state.counters["EdgesTraversed"] = benchmark::Counter(
+    reachable_edge_count(g, source) * state.iterations(), benchmark::Counter::kIsRate);
+}
+BENCHMARK(BM_BoostGraphBFS)
+  ->Args({100, 5})     // Small graph (100 vertices, ~5 edges per vertex)
+  ->Args({1000, 10})   // Medium graph (1000 vertices, ~10 edges per vertex)
+  ->Args({5000, 20})   // Large graph (5000 vertices, ~20 edges per vertex)
+  ->Args({100000, 16}); // Low-diameter graph with large frontiers
+
+// Breadth-First Search on a frozen CSR copy of the same undirected random graph
+static void BM_BoostGraphCSRBFS(benchmark::State& state) {
+  // Graph parameters
+  int num_vertices = state.range(0);
+  int num_edges = num_vertices * state.range(1); // Average number of edges per vertex
+  
+  typedef boost::adjacency_list<
+    boost::vecS,       // OutEdgeList
+    boost::vecS,       // VertexList
+    boost::undirectedS // Undirected graph
+  > Graph;
+  
+  typedef boost::graph_traits<Graph>::edge_descriptor Edge;
+  typedef boost::graph_traits<CSRGraph>::vertex_descriptor Vertex;
+  
+  // Generate the adjacency_list graph and freeze it into CSR form
+  // (each undirected edge becomes two directed CSR edges)
+  Graph source_graph;
+  std::map<Edge, int> weights;
+  boost::associative_property_map<std::map<Edge, int>> weight_map(weights);
+  generate_random_graph(source_graph, weight_map, num_vertices, num_edges);
+  
+  CSRGraph g;
+  build_csr_graph(g, source_graph, weight_map);
+  
+  // Pick source vertex
+  Vertex source = 0;
+  
+  for (auto _ : state) {
+    // Prepare data structures for BFS
+    std::vector<Vertex> predecessors(num_vertices,
+                                   boost::graph_traits<CSRGraph>::null_vertex());
+    std::vector<int> distances(num_vertices, -1);
+    
+    // Property maps
+    auto pred_map = boost::make_iterator_property_map(predecessors.begin(),
+                                                     boost::get(boost::vertex_index, g));
+    auto dist_map = boost::make_iterator_property_map(distances.begin(),
+                                                     boost::get(boost::vertex_index, g));
+    
+    // Run BFS
+    boost::breadth_first_search(g, source,
+      boost::visitor(
+        boost::make_bfs_visitor(
+          std::make_pair(
+            boost::record_distances(dist_map, boost::on_tree_edge()),
+            boost::record_predecessors(pred_map, boost::on_tree_edge())
+          )
+        )
+      )
+    );
+    
+    benchmark::DoNotOptimize(distances);
+    benchmark::DoNotOptimize(predecessors);
+  }
+  
+  state.counters["Vertices"] = num_vertices;
+  state.counters["Edges"] = num_edges;
+  state.counters["EdgeDensity"] = static_cast<double>(num_edges) / num_vertices;
+  // Per undirected edge, to compare directly with BM_BoostGraphBFS
+  state.counters["BytesPerEdge"] = csr_graph_bytes(g) / boost::num_edges(source_graph);
+  state.counters["EdgesTraversed"] = benchmark::Counter(
+    reachable_edge_count(g, source) * state.iterations(), benchmark::Counter::kIsRate);
+}
+BENCHMARK(BM_BoostGraphCSRBFS)
+  ->Args({100, 5})     // Small graph (100 vertices, ~5 edges per vertex)
+  ->Args({1000, 10})   // Medium graph (1000 vertices, ~10 edges per vertex)
+  ->Args({5000, 20});  // Large graph (5000 vertices, ~20 edges per vertex)
+
+// Direction-optimizing BFS (Beamer et al.) over an undirected graph. Levels
+// are expanded top-down from a queue while the frontier is small and
+// bottom-up (every unvisited vertex scans its neighbors for a parent in a
+// frontier bitmap) once the frontier's edges outnumber a fraction of the
+// unexplored edges. Alpha and beta are the switching thresholds from the
+// original paper.
+template <typename Graph>
+class DirectionOptimizingBFS {
+public:
+  typedef typename boost::graph_traits<Graph>::vertex_descriptor Vertex;
+  
+  explicit DirectionOptimizingBFS(const Graph& g, int alpha = 15, int beta = 18)
+    : m_graph(g), m_alpha(alpha), m_beta(beta),
+      m_frontier_bits((boost::num_vertices(g) + 63) / 64),
+      m_next_bits(m_frontier_bits.size()) {
+    m_frontier.reserve(boost::num_vertices(g));
+    m_next.reserve(boost::num_vertices(g));
+  }
+  
+  // Fill distances (-1 for unreached) and predecessors from source
+  void run(Vertex source, std::vector<int>& distances, std::vector<Vertex>& predecessors) {
+    const std::size_t n = boost::num_vertices(m_graph);
+    std::fill(distances.begin(), distances.end(), -1);
+    m_top_down_steps = 0;
+    m_bottom_up_steps = 0;
+    m_edges_examined = 0;
+    
+    distances[source] = 0;
+    predecessors[source] = source;
+    m_frontier.assign(1, source);
+    
+    // Edges incident to the frontier vs. edges incident to unvisited vertices
+    double frontier_edges = boost::out_degree(source, m_graph);
+    double unexplored_edges = 2.0 * boost::num_edges(m_graph) - frontier_edges;
+    bool bottom_up = false;
+    
+    for (int level = 0; !m_frontier.empty(); ++level) {
+      if (!bottom_up && frontier_edges > unexplored_edges / m_alpha) {
+        bottom_up = true;
+        to_bitmap(m_frontier, m_frontier_bits);
+      } else if (bottom_up && m_frontier.size() < n / m_beta) {
+        bottom_up = false;
+      }
+      
+      if (bottom_up) {
+        bottom_up_step(level, distances, predecessors);
+        ++m_bottom_up_steps;
+      } else {
+        top_down_step(level, distances, predecessors);
+        ++m_top_down_steps;
+      }
+      
+      frontier_edges = 0;
+      for (Vertex v : m_next) {
+        frontier_edges += boost::out_degree(v, m_graph);
+      }
+      unexplored_edges -= frontier_edges;
+      m_frontier.swap(m_next);
+      m_next.clear();
+      if (bottom_up) {
+        m_frontier_bits.swap(m_next_bits);
+      }
+    }
+  }
+  
+  int top_down_steps() const { return m_top_down_steps; }
+  int bottom_up_steps() const { return m_bottom_up_steps; }
+  double edges_examined() const { return m_edges_examined; }
+  
+private:
+  void top_down_step(int level, std::vector<int>& distances, std::vector<Vertex>& predecessors) {
+    for (Vertex u : m_frontier) {
+      typename boost::graph_traits<Graph>::out_edge_iterator ei, ei_end;
+      for (boost::tie(ei, ei_end) = boost::out_edges(u, m_graph); ei != ei_end; ++ei) {
+        ++m_edges_examined;
+        Vertex v = boost::target(*ei, m_graph);
+        if (distances[v] < 0) {
+          distances[v] = level + 1;
+          predecessors[v] = u;
+          m_next.push_back(v);
+        }
+      }
+    }
+  }
+  
+  void bottom_up_step(int level, std::vector<int>& distances, std::vector<Vertex>& predecessors) {
+    std::fill(m_next_bits.begin(), m_next_bits.end(), 0);
+    const std::size_t n = boost::num_vertices(m_graph);
+    for (Vertex v = 0; v < n; ++v) {
+      if (distances[v] >= 0) {
+        continue;
+      }
+      typename boost::graph_traits<Graph>::out_edge_iterator ei, ei_end;
+      for (boost::tie(ei, ei_end) = boost::out_edges(v, m_graph); ei != ei_end; ++ei) {
+        ++m_edges_examined;
+        Vertex u = boost::target(*ei, m_graph);
+        if (m_frontier_bits[u / 64] & (std::uint64_t(1) << (u % 64))) {
+          distances[v] = level + 1;
+          predecessors[v] = u;
+          m_next_bits[v / 64] |= std::uint64_t(1) << (v % 64);
+          m_next.push_back(v);
+          break;
+        }
+      }
+    }
+  }
+  
+  static void to_bitmap(const std::vector<Vertex>& vertices, std::vector<std::uint64_t>& bits) {
+    std::fill(bits.begin(), bits.end(), 0);
+    for (Vertex v : vertices) {
+      bits[v / 64] |= std::uint64_t(1) << (v % 64);
+    }
+  }
+  
+  const Graph& m_graph;
+  int m_alpha;
+  int m_beta;
+  std::vector<Vertex> m_frontier;
+  std::vector<Vertex> m_next;
+  std::vector<std::uint64_t> m_frontier_bits;
+  std::vector<std::uint64_t> m_next_bits;
+  int m_top_down_steps = 0;
+  int m_bottom_up_steps = 0;
+  double m_edges_examined = 0;
+};
+
+// Direction-optimizing BFS on the same undirected random graph as
+// BM_BoostGraphBFS, validated against boost::breadth_first_search
+static void BM_BoostGraphBFSDirectionOptimizing(benchmark::State& state) {
+  // Graph parameters
+  int num_vertices = state.range(0);
+  int num_edges = num_vertices * state.range(1); // Average number of edges per vertex
+  
+  // Define the graph type
+  typedef boost::adjacency_list<
+    boost::vecS,       // OutEdgeList
+    boost::vecS,       // VertexList
+    boost::undirectedS // Undirected graph
+  > Graph;
+  
+  typedef boost::graph_traits<Graph>::vertex_descriptor Vertex;
+  typedef boost::graph_traits<Graph>::edge_descriptor Edge;
+  
+  // Create graph
+  Graph g;
+  std::map<Edge, int> weights;
+  boost::associative_property_map<std::map<Edge, int>> weight_map(weights);
+  generate_random_graph(g, weight_map, num_vertices, num_edges);
+  
+  // Pick source vertex
+  Vertex source = 0;
+  
+  DirectionOptimizingBFS<Graph> bfs(g);
+  std::vector<int> distances(num_vertices);
+  std::vector<Vertex> predecessors(num_vertices);
+  
+  // Validate distances against Boost's BFS
+  {
+    std::vector<int> reference(num_vertices, -1);
+    reference[source] = 0;
+    auto ref_map = boost::make_iterator_property_map(reference.begin(), boost::get(boost::vertex_index, g));
+    boost::breadth_first_search(g, source,
+      boost::visitor(boost::make_bfs_visitor(boost::record_distances(ref_map, boost::on_tree_edge()))));
+    bfs.run(source, distances, predecessors);
+    if (distances != reference) {
+      state.SkipWithError("Direction-optimizing BFS distances do not match boost::breadth_first_search");
+      return;
+    }
+  }
+  
+  for (auto _ : state) {
+    bfs.run(source, distances, predecessors);
+    benchmark::DoNotOptimize(distances.data());
+    benchmark::DoNotOptimize(predecessors.data());
+  }
+  
+  state.counters["Vertices"] = num_vertices;
+  state.counters["Edges"] = num_edges;
+  state.counters["EdgeDensity"] = static_cast<double>(num_edges) / num_vertices;
+  state.counters["TopDownSteps"] = bfs.top_down_steps();
+  state.counters["BottomUpSteps"] = bfs.bottom_up_steps();
+  state.counters["EdgesExamined"] = bfs.edges_examined();
+  // Same definition as BM_BoostGraphBFS, so the rates compare directly
+  state.counters["EdgesTraversed"] = benchmark::Counter(
+    reachable_edge_count(g, source) * state.iterations(), benchmark::Counter::kIsRate);
+}
+BENCHMARK(BM_BoostGraphBFSDirectionOptimizing)
+  ->Args({1000, 10})    // Medium graph (1000 vertices, ~10 edges per vertex)
+  ->Args({5000, 20})    // Large graph (5000 vertices, ~20 edges per vertex)
+  ->Args({100000, 16}); // Low-diameter graph with large frontiers
+
+// DFS Visitor to count components
+class DFSVisitor : public boost::default_dfs_visitor {
+public:
+  DFSVisitor(int* count) : m_count(count) {}
+  
+  template <typename Vertex, typename Graph>
+  void start_vertex(Vertex, const Graph&) {
+    (*m_count)++;
+  }
+  
+private:
+  int* m_count;
+};
+
+// Benchmark for Depth-First Search algorithm
+static void BM_BoostGraphDFS(benchmark::State& state) {
+  // Graph parameters
+  int num_vertices = state.range(0);
+  int num_edges = num_vertices * state.range(1); // Average number of edges per vertex
+  
+  // Define the graph type
+  typedef boost::adjacency_list<
+    boost::vecS,       // OutEdgeList
+    boost::vecS,       // VertexList
+    boost::undirectedS // Undirected graph
+  > Graph;
+  
+  typedef boost::graph_traits<Graph>::edge_descriptor Edge;
+  
+  // Create graph
+  Graph g;
+  
+  // Edge weights (not used for DFS, but needed for interface)
+  std::map<Edge, int> weights;
+  boost::associative_property_map<std::map<Edge, int>> weight_map(weights);
+  
+  // Generate graph
+  generate_random_graph(g, weight_map, num_vertices, num_edges);
+  
+  for (auto _ : state) {
+    // Vector for vertex colors (used by DFS to track visited vertices)
+    std::vector<boost::default_color_type> colors(num_vertices);
+    auto color_map = boost::make_iterator_property_map(colors.begin(), 
+                                                      boost::get(boost::vertex_index, g));
+    
+    // Count number of connected components
+    int component_count = 0;
+    DFSVisitor visitor(&component_count);
+    
+    // Run DFS
+    boost::depth_first_search(g, boost::visitor(visitor).color_map(color_map));
+    
+    benchmark::DoNotOptimize(colors);
+    benchmark::DoNotOptimize(component_count);
   }
   
   state.counters["Vertices"] = num_vertices;
   state.counters["Edges"] = num_edges;
   state.counters["EdgeDensity"] = static_cast<double>(num_edges) / num_vertices;
+  // A full DFS scans every out-edge of every vertex once
+  state.counters["BytesPerEdge"] = adjacency_list_bytes(g) / boost::num_edges(g);
+  state.counters["EdgesTraversed"] = benchmark::Counter(
+    2.0 * boost::num_edges(g) * state.iterations(), benchmark::Counter::kIsRate);
 }
-BENCHMARK(BM_BoostGraphBFS)
+BENCHMARK(BM_BoostGraphDFS)
   ->Args({100, 5})     // Small graph (100 vertices, ~5 edges per vertex)
   ->Args({1000, 10})   // Medium graph (1000 vertices, ~10 edges per vertex)
   ->Args({5000, 20});  // Large graph (5000 vertices, ~20 edges per vertex)
 
-// DFS Visitor to count components
-class DFSVisitor : public boost::default_dfs_visitor {
-public:
-  DFSVisitor(int* count) : m_count(count) {}
-  
-  template <typename Vertex, typename Graph>
-  void start_vertex(Vertex, const Graph&) {
-    (*m_count)++;
-  }
-  
-private:
-  int* m_count;
-};
-
-// Benchmark for Depth-First Search algorithm
-static void BM_BoostGraphDFS(benchmark::State& state) {
+// Depth-First Search on a frozen CSR copy of the same undirected random graph
+static void BM_BoostGraphCSRDFS(benchmark::State& state) {
   // Graph parameters
   int num_vertices = state.range(0);
   int num_edges = num_vertices * state.range(1); // Average number of edges per vertex
   
-  // Define the graph type
   typedef boost::adjacency_list<
     boost::vecS,       // OutEdgeList
     boost::vecS,       // VertexList
@@ -417,20 +2018,20 @@ static void BM_BoostGraphDFS(benchmark::State& state) {
   
   typedef boost::graph_traits<Graph>::edge_descriptor Edge;
   
-  // Create graph
-  Graph g;
-  
-  // Edge weights (not used for DFS, but needed for interface)
+  // Generate the adjacency_list graph and freeze it into CSR form
+  // (each undirected edge becomes two directed CSR edges)
+  Graph source_graph;
   std::map<Edge, int> weights;
   boost::associative_property_map<std::map<Edge, int>> weight_map(weights);
+  generate_random_graph(source_graph, weight_map, num_vertices, num_edges);
   
-  // Generate graph
-  generate_random_graph(g, weight_map, num_vertices, num_edges);
+  CSRGraph g;
+  build_csr_graph(g, source_graph, weight_map);
   
   for (auto _ : state) {
     // Vector for vertex colors (used by DFS to track visited vertices)
     std::vector<boost::default_color_type> colors(num_vertices);
-    auto color_map = boost::make_iterator_property_map(colors.begin(), 
+    auto color_map = boost::make_iterator_property_map(colors.begin(),
                                                       boost::get(boost::vertex_index, g));
     
     // Count number of connected components
@@ -447,10 +2048,822 @@ static void BM_BoostGraphDFS(benchmark::State& state) {
   state.counters["Vertices"] = num_vertices;
   state.counters["Edges"] = num_edges;
   state.counters["EdgeDensity"] = static_cast<double>(num_edges) / num_vertices;
+  // Per undirected edge, to compare directly with BM_BoostGraphDFS
+  state.counters["BytesPerEdge"] = csr_graph_bytes(g) / boost::num_edges(source_graph);
+  state.counters["EdgesTraversed"] = benchmark::Counter(
+    static_cast<double>(boost::num_edges(g)) * state.iterations(), benchmark::Counter::kIsRate);
 }
-BENCHMARK(BM_BoostGraphDFS)
+BENCHMARK(BM_BoostGraphCSRDFS)
   ->Args({100, 5})     // Small graph (100 vertices, ~5 edges per vertex)
   ->Args({1000, 10})   // Medium graph (1000 vertices, ~10 edges per vertex)
   ->Args({5000, 20});  // Large graph (5000 vertices, ~20 edges per vertex)
 
+// Connected components and vertex ordering. The same R-MAT graph is
+// relabeled before construction, so every ordering shares one edge set and
+// one build pipeline and differs only in vertex ids (and thus memory layout).
+
+typedef boost::adjacency_list<
+  boost::vecS,       // OutEdgeList
+  boost::vecS,       // VertexList
+  boost::undirectedS // Undirected graph
+> ComponentGraph;
+
+typedef boost::graph_traits<ComponentGraph>::vertex_descriptor ComponentVertex;
+
+typedef std::pair<std::uint32_t, std::uint32_t> EdgePair;
+
+enum VertexOrdering {
+  kGeneratedOrder = 0,   // Vertex ids as generated (randomly permuted)
+  kReverseCuthillMcKee,  // Bandwidth-reducing BFS order
+  kDegreeSorted          // Descending degree, hubs first
+};
+
+static const char* vertex_ordering_name(int ordering) {
+  switch (ordering) {
+    case kReverseCuthillMcKee: return "rcm";
+    case kDegreeSorted: return "degree";
+    default: return "generated";
+  }
+}
+
+// Undirected graph plus the reference component count
+struct ComponentWorkload {
+  ComponentGraph g;
+  std::size_t components;
+  double average_edge_span; // Mean |u - v| over edges, a proxy for locality
+};
+
+// Returns new_id[old_id] for the requested ordering of g
+static std::vector<ComponentVertex> vertex_relabeling(const ComponentGraph& g, int ordering) {
+  const std::size_t n = boost::num_vertices(g);
+  std::vector<ComponentVertex> order(n); // order[new_id] = old_id
+  
+  if (ordering == kReverseCuthillMcKee) {
+    // Start each component at a minimum-degree vertex. Boost's own
+    // pseudo-peripheral search rescans every vertex once per component,
+    // which is quadratic on R-MAT graphs with many small components.
+    std::vector<int> component(n);
+    int num_components = boost::connected_components(g,
+      boost::make_iterator_property_map(component.begin(), boost::get(boost::vertex_index, g)));
+    std::vector<ComponentVertex> start(num_components, boost::graph_traits<ComponentGraph>::null_vertex());
+    for (std::size_t v = 0; v < n; ++v) {
+      ComponentVertex& s = start[component[v]];
+      if (s == boost::graph_traits<ComponentGraph>::null_vertex() ||
+          boost::out_degree(v, g) < boost::out_degree(s, g)) {
+        s = v;
+      }
+    }
+    
+    std::vector<boost::default_color_type> colors(n);
+    boost::cuthill_mckee_ordering(g, std::deque<ComponentVertex>(start.begin(), start.end()), order.rbegin(),
+      boost::make_iterator_property_map(colors.begin(), boost::get(boost::vertex_index, g)),
+      boost::make_degree_map(g));
+  } else {
+    for (std::size_t v = 0; v < n; ++v) {
+      order[v] = v;
+    }
+    if (ordering == kDegreeSorted) {
+      std::stable_sort(order.begin(), order.end(), [&](ComponentVertex a, ComponentVertex b) {
+        return boost::out_degree(a, g) > boost::out_degree(b, g);
+      });
+    }
+  }
+  
+  std::vector<ComponentVertex> new_id(n);
+  for (std::size_t i = 0; i < n; ++i) {
+    new_id[order[i]] = i;
+  }
+  return new_id;
+}
+
+// Build the symmetric R-MAT graph once per (scale, edge factor) and keep the
+// most recent relabeled copy across benchmark invocations
+static const ComponentWorkload& component_workload(int scale, int edge_factor, int ordering) {
+  static std::unique_ptr<ComponentWorkload> workload;
+  static std::vector<int> workload_params;
+  
+  std::vector<int> params = {scale, edge_factor, ordering};
+  if (!workload || workload_params != params) {
+    workload.reset();
+    workload_params = params;
+    
+    // Undirected, simple version of the R-MAT edge list
+    std::vector<EdgePair> pairs;
+    for (const auto& edge : workloads::cached_rmat_edges(scale, edge_factor, 100)) {
+      pairs.emplace_back(std::min(edge.source, edge.target), std::max(edge.source, edge.target));
+    }
+    std::sort(pairs.begin(), pairs.end());
+    pairs.erase(std::unique(pairs.begin(), pairs.end()), pairs.end());
+    
+    std::size_t n = std::size_t(1) << scale;
+    auto new_id = vertex_relabeling(ComponentGraph(pairs.begin(), pairs.end(), n), ordering);
+    
+    // Sorted relabeled edges give ascending adjacency lists
+    double span = 0;
+    for (auto& pair : pairs) {
+      std::uint32_t u = new_id[pair.first];
+      std::uint32_t v = new_id[pair.second];
+      pair = EdgePair(std::min(u, v), std::max(u, v));
+      span += pair.second - pair.first;
+    }
+    std::sort(pairs.begin(), pairs.end());
+    
+    workload.reset(new ComponentWorkload{ComponentGraph(pairs.begin(), pairs.end(), n), 0,
+                                         pairs.empty() ? 0.0 : span / pairs.size()});
+    std::vector<int> component(n);
+    workload->components = boost::connected_components(workload->g,
+      boost::make_iterator_property_map(component.begin(), boost::get(boost::vertex_index, workload->g)));
+  }
+  return *workload;
+}
+
+// A labeling is correct if it has the reference number of distinct labels
+// and agrees across every edge
+template <typename Labels>
+static bool same_components(const ComponentWorkload& workload, const Labels& labels) {
+  const ComponentGraph& g = workload.g;
+  std::vector<bool> seen(boost::num_vertices(g), false);
+  std::size_t distinct = 0;
+  for (std::size_t v = 0; v < boost::num_vertices(g); ++v) {
+    std::size_t label = labels[v];
+    if (label >= seen.size()) {
+      return false;
+    }
+    if (!seen[label]) {
+      seen[label] = true;
+      ++distinct;
+    }
+  }
+  if (distinct != workload.components) {
+    return false;
+  }
+  for (auto e : boost::make_iterator_range(boost::edges(g))) {
+    if (labels[boost::source(e, g)] != labels[boost::target(e, g)]) {
+      return false;
+    }
+  }
+  return true;
+}
+
+static void set_component_counters(benchmark::State& state, const ComponentWorkload& workload) {
+  state.SetLabel(vertex_ordering_name(state.range(2)));
+  state.counters["Vertices"] = boost::num_vertices(workload.g);
+  state.counters["Edges"] = boost::num_edges(workload.g);
+  state.counters["Components"] = workload.components;
+  state.counters["AvgEdgeSpan"] = workload.average_edge_span;
+  state.counters["EdgesTraversed"] = benchmark::Counter(
+    2.0 * boost::num_edges(workload.g) * state.iterations(), benchmark::Counter::kIsRate);
+}
+
+// Arguments for the components suite: {scale, edge factor, ordering}
+static void ComponentArgs(benchmark::internal::Benchmark* b) {
+  for (int ordering : {kGeneratedOrder, kReverseCuthillMcKee, kDegreeSorted}) {
+    b->Args({17, 8, ordering});   // 131k vertices, 1M edges
+  }
+  for (int ordering : {kGeneratedOrder, kReverseCuthillMcKee, kDegreeSorted}) {
+    b->Args({20, 8, ordering});   // 1M vertices, 8.4M edges
+  }
+}
+
+// boost::connected_components (DFS based)
+static void BM_BoostGraphConnectedComponents(benchmark::State& state) {
+  const ComponentWorkload& workload = component_workload(state.range(0), state.range(1), state.range(2));
+  const ComponentGraph& g = workload.g;
+  
+  std::vector<int> component(boost::num_vertices(g));
+  std::vector<boost::default_color_type> colors(boost::num_vertices(g));
+  auto index_map = boost::get(boost::vertex_index, g);
+  
+  for (auto _ : state) {
+    int count = boost::connected_components(g,
+      boost::make_iterator_property_map(component.begin(), index_map),
+      boost::color_map(boost::make_iterator_property_map(colors.begin(), index_map)));
+    benchmark::DoNotOptimize(count);
+    benchmark::DoNotOptimize(component.data());
+  }
+  
+  set_component_counters(state, workload);
+}
+BENCHMARK(BM_BoostGraphConnectedComponents)
+  ->Apply(ComponentArgs)
+  ->Unit(benchmark::kMillisecond);
+
+// Union-find over boost::disjoint_sets, visiting each undirected edge once
+// from its lower endpoint
+static void BM_BoostGraphUnionFindComponents(benchmark::State& state) {
+  const ComponentWorkload& workload = component_workload(state.range(0), state.range(1), state.range(2));
+  const ComponentGraph& g = workload.g;
+  const std::size_t n = boost::num_vertices(g);
+  
+  std::vector<std::size_t> rank(n);
+  std::vector<ComponentVertex> parent(n);
+  typedef boost::iterator_property_map<std::vector<std::size_t>::iterator, boost::identity_property_map> RankMap;
+  typedef boost::iterator_property_map<std::vector<ComponentVertex>::iterator, boost::identity_property_map> ParentMap;
+  boost::disjoint_sets<RankMap, ParentMap> sets(RankMap(rank.begin()), ParentMap(parent.begin()));
+  
+  auto run = [&] {
+    for (ComponentVertex v = 0; v < n; ++v) {
+      sets.make_set(v);
+    }
+    for (ComponentVertex u = 0; u < n; ++u) {
+      for (ComponentVertex v : boost::make_iterator_range(boost::adjacent_vertices(u, g))) {
+        if (u < v) {
+          sets.union_set(u, v);
+        }
+      }
+    }
+    sets.compress_sets(boost::counting_iterator<ComponentVertex>(0),
+                       boost::counting_iterator<ComponentVertex>(n));
+  };
+  
+  run();
+  if (!same_components(workload, parent)) {
+    state.SkipWithError("Union-find components do not match connected_components");
+    return;
+  }
+  
+  for (auto _ : state) {
+    run();
+    benchmark::DoNotOptimize(parent.data());
+  }
+  
+  set_component_counters(state, workload);
+}
+BENCHMARK(BM_BoostGraphUnionFindComponents)
+  ->Apply(ComponentArgs)
+  ->Unit(benchmark::kMillisecond);
+
+// Parallel Afforest (Sutton et al.), as in the GAP benchmark suite. Every
+// vertex first links to a couple of sampled neighbors, which already merges
+// most of the giant component. The most frequent label is then estimated by
+// sampling, and only vertices outside that component scan their remaining
+// neighbors. Links are lock-free CAS hooks of the higher root onto the lower.
+template <typename Graph>
+class AfforestComponents {
+public:
+  typedef typename boost::graph_traits<Graph>::vertex_descriptor Vertex;
+  
+  AfforestComponents(const Graph& g, ForkJoinPool& pool, int neighbor_rounds = 2)
+    : m_graph(g), m_pool(pool), m_neighbor_rounds(neighbor_rounds),
+      m_component(boost::num_vertices(g)) {}
+  
+  void run() {
+    const std::size_t n = boost::num_vertices(m_graph);
+    parallel_for([&](Vertex v) { m_component[v].store(v, std::memory_order_relaxed); });
+    
+    for (int round = 0; round < m_neighbor_rounds; ++round) {
+      parallel_for([&](Vertex u) {
+        auto neighbors = boost::adjacent_vertices(u, m_graph);
+        if (boost::out_degree(u, m_graph) > static_cast<std::size_t>(round)) {
+          link(u, *std::next(neighbors.first, round));
+        }
+      });
+      parallel_for([&](Vertex v) { compress(v); });
+    }
+    
+    // Skip the largest intermediate component for the remaining edges
+    std::uint32_t largest = most_frequent_label(n);
+    parallel_for([&](Vertex u) {
+      if (m_component[u].load(std::memory_order_relaxed) == largest) {
+        return;
+      }
+      auto neighbors = boost::adjacent_vertices(u, m_graph);
+      if (boost::out_degree(u, m_graph) <= static_cast<std::size_t>(m_neighbor_rounds)) {
+        return;
+      }
+      for (auto it = std::next(neighbors.first, m_neighbor_rounds); it != neighbors.second; ++it) {
+        link(u, *it);
+      }
+    });
+    parallel_for([&](Vertex v) { compress(v); });
+  }
+  
+  std::uint32_t operator[](std::size_t v) const {
+    return m_component[v].load(std::memory_order_relaxed);
+  }
+  
+private:
+  // Hook the higher of the two roots onto the lower one
+  void link(std::uint32_t u, std::uint32_t v) {
+    std::uint32_t p1 = m_component[u].load(std::memory_order_relaxed);
+    std::uint32_t p2 = m_component[v].load(std::memory_order_relaxed);
+    while (p1 != p2) {
+      std::uint32_t high = std::max(p1, p2);
+      std::uint32_t low = std::min(p1, p2);
+      std::uint32_t p_high = m_component[high].load(std::memory_order_relaxed);
+      if (p_high == low) {
+        break;
+      }
+      if (p_high == high &&
+          m_component[high].compare_exchange_strong(p_high, low, std::memory_order_relaxed)) {
+        break;
+      }
+      p1 = m_component[m_component[high].load(std::memory_order_relaxed)].load(std::memory_order_relaxed);
+      p2 = m_component[low].load(std::memory_order_relaxed);
+    }
+  }
+  
+  void compress(std::uint32_t v) {
+    for (;;) {
+      std::uint32_t parent = m_component[v].load(std::memory_order_relaxed);
+      std::uint32_t grandparent = m_component[parent].load(std::memory_order_relaxed);
+      if (parent == grandparent) {
+        break;
+      }
+      m_component[v].store(grandparent, std::memory_order_relaxed);
+    }
+  }
+  
+  std::uint32_t most_frequent_label(std::size_t n) {
+    std::mt19937 rng(27491095);
+    std::uniform_int_distribution<std::size_t> pick(0, n - 1);
+    std::map<std::uint32_t, int> counts;
+    for (int i = 0; i < 1024; ++i) {
+      ++counts[m_component[pick(rng)].load(std::memory_order_relaxed)];
+    }
+    return std::max_element(counts.begin(), counts.end(),
+      [](const std::pair<const std::uint32_t, int>& a, const std::pair<const std::uint32_t, int>& b) {
+        return a.second < b.second;
+      })->first;
+  }
+  
+  // Dynamically scheduled blocks, since R-MAT degrees are heavily skewed
+  template <typename Body>
+  void parallel_for(const Body& body) {
+    const std::size_t n = boost::num_vertices(m_graph);
+    const std::size_t block = 4096;
+    std::atomic<std::size_t> next(0);
+    m_pool.run([&](int) {
+      for (std::size_t begin = next.fetch_add(block); begin < n; begin = next.fetch_add(block)) {
+        std::size_t end = std::min(n, begin + block);
+        for (std::size_t v = begin; v < end; ++v) {
+          body(static_cast<Vertex>(v));
+        }
+      }
+    });
+  }
+  
+  const Graph& m_graph;
+  ForkJoinPool& m_pool;
+  int m_neighbor_rounds;
+  std::vector<std::atomic<std::uint32_t>> m_component;
+};
+
+// Arguments for Afforest: the components suite at the hardware thread count
+static void AfforestArgs(benchmark::internal::Benchmark* b) {
+  int max_threads = std::max(1u, std::thread::hardware_concurrency());
+  for (int scale : {17, 20}) {
+    for (int ordering : {kGeneratedOrder, kReverseCuthillMcKee, kDegreeSorted}) {
+      b->Args({scale, 8, ordering, max_threads});
+    }
+  }
+}
+
+static void BM_BoostGraphAfforestComponents(benchmark::State& state) {
+  const ComponentWorkload& workload = component_workload(state.range(0), state.range(1), state.range(2));
+  int num_threads = state.range(3);
+  
+  ForkJoinPool pool(num_threads);
+  AfforestComponents<ComponentGraph> afforest(workload.g, pool);
+  
+  afforest.run();
+  if (!same_components(workload, afforest)) {
+    state.SkipWithError("Afforest components do not match connected_components");
+    return;
+  }
+  
+  for (auto _ : state) {
+    afforest.run();
+    benchmark::ClobberMemory();
+  }
+  
+  set_component_counters(state, workload);
+  state.counters["Threads"] = num_threads;
+}
+BENCHMARK(BM_BoostGraphAfforestComponents)
+  ->Apply(AfforestArgs)
+  ->Unit(benchmark::kMillisecond)
+  ->UseRealTime();
+
+// Graph construction throughput. Each benchmark loads the same edge list
+// (generated untimed) into a graph; the timed region includes tearing the
+// previous graph down, as a reload would.
+
+// Directed weighted adjacency_list used by the construction benchmarks
+typedef boost::adjacency_list<
+  boost::vecS,
+  boost::vecS,
+  boost::directedS,
+  boost::no_property,
+  WeightedEdge
+> LoadedGraph;
+
+// Split an edge list into the (source, target) pairs and edge properties the
+// range constructors take
+static void split_edge_list(const workloads::EdgeList& edges,
+                            std::vector<EdgePair>& pairs, std::vector<WeightedEdge>& properties) {
+  pairs.clear();
+  properties.clear();
+  pairs.reserve(edges.size());
+  properties.reserve(edges.size());
+  for (const auto& edge : edges) {
+    pairs.emplace_back(edge.source, edge.target);
+    properties.push_back(WeightedEdge{edge.weight});
+  }
+}
+
+static bool edge_less(const workloads::Edge& a, const workloads::Edge& b) {
+  return a.source != b.source ? a.source < b.source : a.target < b.target;
+}
+
+static bool edge_equal(const workloads::Edge& a, const workloads::Edge& b) {
+  return a.source == b.source && a.target == b.target;
+}
+
+// Report construction throughput and the resulting footprint
+static void set_construction_counters(benchmark::State& state, double num_edges, double graph_bytes) {
+  state.counters["Edges"] = num_edges;
+  state.counters["EdgesPerSecond"] = benchmark::Counter(
+    num_edges * state.iterations(), benchmark::Counter::kIsRate);
+  state.counters["GraphBytes"] = benchmark::Counter(
+    graph_bytes, benchmark::Counter::kDefaults, benchmark::Counter::OneK::kIs1024);
+  state.counters["BytesPerEdge"] = graph_bytes / num_edges;
+}
+
+// One add_edge call per edge, in generation order
+static void BM_BoostGraphBuildIncremental(benchmark::State& state) {
+  int num_vertices = state.range(0);
+  auto edges = workloads::cached_random_edges(num_vertices, num_vertices * state.range(1), 100, false);
+  
+  auto build = [&] {
+    LoadedGraph g(num_vertices);
+    for (const auto& edge : edges) {
+      boost::add_edge(edge.source, edge.target, WeightedEdge{edge.weight}, g);
+    }
+    return g;
+  };
+  
+  for (auto _ : state) {
+    LoadedGraph g = build();
+    benchmark::DoNotOptimize(g);
+  }
+  
+  // Footprint of one more graph, built outside the timed region
+  set_construction_counters(state, edges.size(), adjacency_list_bytes(build()));
+}
+BENCHMARK(BM_BoostGraphBuildIncremental)
+  ->Args({100000, 16})    // 100k vertices, 1.6M edges
+  ->Args({1000000, 16})   // 1M vertices, 16M edges
+  ->Unit(benchmark::kMillisecond);
+
+// adjacency_list range constructor over edges sorted by source
+static void BM_BoostGraphBuildBulkSorted(benchmark::State& state) {
+  int num_vertices = state.range(0);
+  auto edges = workloads::cached_random_edges(num_vertices, num_vertices * state.range(1), 100, false);
+  std::sort(edges.begin(), edges.end(), edge_less);
+  
+  std::vector<EdgePair> pairs;
+  std::vector<WeightedEdge> properties;
+  split_edge_list(edges, pairs, properties);
+  
+  for (auto _ : state) {
+    LoadedGraph g(pairs.begin(), pairs.end(), properties.begin(), num_vertices);
+    benchmark::DoNotOptimize(g);
+  }
+  
+  // Footprint of one more graph, built outside the timed region
+  LoadedGraph g(pairs.begin(), pairs.end(), properties.begin(), num_vertices);
+  set_construction_counters(state, edges.size(), adjacency_list_bytes(g));
+}
+BENCHMARK(BM_BoostGraphBuildBulkSorted)
+  ->Args({100000, 16})    // 100k vertices, 1.6M edges
+  ->Args({1000000, 16})   // 1M vertices, 16M edges
+  ->Unit(benchmark::kMillisecond);
+
+// CSR construction from edges in generation (unsorted) order
+static void BM_BoostGraphBuildCSRUnsorted(benchmark::State& state) {
+  int num_vertices = state.range(0);
+  auto edges = workloads::cached_random_edges(num_vertices, num_vertices * state.range(1), 100, false);
+  
+  std::vector<EdgePair> pairs;
+  std::vector<WeightedEdge> properties;
+  split_edge_list(edges, pairs, properties);
+  
+  for (auto _ : state) {
+    CSRGraph g(boost::edges_are_unsorted_multi_pass,
+               pairs.begin(), pairs.end(), properties.begin(), num_vertices);
+    benchmark::DoNotOptimize(g);
+  }
+  
+  // Footprint of one more graph, built outside the timed region
+  CSRGraph g(boost::edges_are_unsorted_multi_pass,
+             pairs.begin(), pairs.end(), properties.begin(), num_vertices);
+  set_construction_counters(state, edges.size(), csr_graph_bytes(g));
+}
+BENCHMARK(BM_BoostGraphBuildCSRUnsorted)
+  ->Args({100000, 16})    // 100k vertices, 1.6M edges
+  ->Args({1000000, 16})   // 1M vertices, 16M edges
+  ->Unit(benchmark::kMillisecond);
+
+// CSR construction from edges already sorted by source
+static void BM_BoostGraphBuildCSRSorted(benchmark::State& state) {
+  int num_vertices = state.range(0);
+  auto edges = workloads::cached_random_edges(num_vertices, num_vertices * state.range(1), 100, false);
+  std::sort(edges.begin(), edges.end(), edge_less);
+  
+  std::vector<EdgePair> pairs;
+  std::vector<WeightedEdge> properties;
+  split_edge_list(edges, pairs, properties);
+  
+  for (auto _ : state) {
+    CSRGraph g(boost::edges_are_sorted,
+               pairs.begin(), pairs.end(), properties.begin(), num_vertices);
+    benchmark::DoNotOptimize(g);
+  }
+  
+  // Footprint of one more graph, built outside the timed region
+  CSRGraph g(boost::edges_are_sorted,
+             pairs.begin(), pairs.end(), properties.begin(), num_vertices);
+  set_construction_counters(state, edges.size(), csr_graph_bytes(g));
+}
+BENCHMARK(BM_BoostGraphBuildCSRSorted)
+  ->Args({100000, 16})    // 100k vertices, 1.6M edges
+  ->Args({1000000, 16})   // 1M vertices, 16M edges
+  ->Unit(benchmark::kMillisecond);
+
+// Parallel sort + dedupe of raw edge draws (with self-loops and duplicates)
+// into a sorted, duplicate-free edge list ready for CSR construction. Edges
+// are bucketed by source range with a counting scatter, then each thread
+// sorts and deduplicates its own bucket.
+static void parallel_sort_dedupe(const workloads::EdgeList& input, workloads::EdgeList& output,
+                                 std::size_t num_vertices, ForkJoinPool& pool) {
+  const std::size_t num_threads = pool.size();
+  const std::size_t chunk = (input.size() + num_threads - 1) / num_threads;
+  auto partition_of = [&](std::uint32_t source) {
+    return static_cast<std::size_t>(source) * num_threads / num_vertices;
+  };
+  
+  // counts[t][p]: edges of input chunk t that belong to partition p
+  std::vector<std::vector<std::size_t>> counts(num_threads, std::vector<std::size_t>(num_threads, 0));
+  pool.run([&](int t) {
+    std::size_t end = std::min(input.size(), (t + 1) * chunk);
+    for (std::size_t i = t * chunk; i < end; ++i) {
+      ++counts[t][partition_of(input[i].source)];
+    }
+  });
+  
+  // Exclusive prefix sums give every (chunk, partition) pair its write offset
+  std::vector<std::size_t> partition_begin(num_threads + 1, 0);
+  std::size_t offset = 0;
+  for (std::size_t p = 0; p < num_threads; ++p) {
+    partition_begin[p] = offset;
+    for (std::size_t t = 0; t < num_threads; ++t) {
+      std::size_t count = counts[t][p];
+      counts[t][p] = offset;
+      offset += count;
+    }
+  }
+  partition_begin[num_threads] = offset;
+  
+  output.resize(input.size());
+  std::vector<std::size_t> partition_end(num_threads);
+  pool.run([&](int t) {
+    std::size_t end = std::min(input.size(), (t + 1) * chunk);
+    for (std::size_t i = t * chunk; i < end; ++i) {
+      output[counts[t][partition_of(input[i].source)]++] = input[i];
+    }
+  });
+  pool.run([&](int p) {
+    auto first = output.begin() + partition_begin[p];
+    auto last = output.begin() + partition_begin[p + 1];
+    last = std::remove_if(first, last, [](const workloads::Edge& e) { return e.source == e.target; });
+    std::sort(first, last, edge_less);
+    partition_end[p] = std::unique(first, last, edge_equal) - output.begin();
+  });
+  
+  // Close the gaps left by removed edges. A partition already in place
+  // (nothing removed before it) is not copied onto itself.
+  std::size_t size = partition_end[0];
+  for (std::size_t p = 1; p < num_threads; ++p) {
+    if (size == partition_begin[p]) {
+      size = partition_end[p];
+    } else {
+      size = std::copy(output.begin() + partition_begin[p], output.begin() + partition_end[p],
+                       output.begin() + size) - output.begin();
+    }
+  }
+  output.resize(size);
+}
+
+// Arguments for the parallel sort + dedupe benchmark: {vertices, edges per vertex, threads}
+static void SortDedupeArgs(benchmark::internal::Benchmark* b) {
+  int max_threads = std::max(1u, std::thread::hardware_concurrency());
+  for (int threads = 1; threads < max_threads; threads *= 2) {
+    b->Args({1000000, 16, threads});
+  }
+  b->Args({1000000, 16, max_threads});
+}
+
+static void BM_BoostGraphEdgeSortDedupe(benchmark::State& state) {
+  int num_vertices = state.range(0);
+  int num_threads = state.range(2);
+  auto input = workloads::uniform_edge_draws(num_vertices, num_vertices * state.range(1), 100);
+  
+  ForkJoinPool pool(num_threads);
+  workloads::EdgeList output;
+  output.reserve(input.size());
+  
+  // Validate against a sequential sort + unique
+  {
+    workloads::EdgeList reference = input;
+    reference.erase(std::remove_if(reference.begin(), reference.end(),
+                                   [](const workloads::Edge& e) { return e.source == e.target; }),
+                    reference.end());
+    std::sort(reference.begin(), reference.end(), edge_less);
+    reference.erase(std::unique(reference.begin(), reference.end(), edge_equal), reference.end());
+    parallel_sort_dedupe(input, output, num_vertices, pool);
+    if (output.size() != reference.size() ||
+        !std::equal(output.begin(), output.end(), reference.begin(), edge_equal)) {
+      state.SkipWithError("Parallel sort + dedupe does not match std::sort + std::unique");
+      return;
+    }
+  }
+  
+  for (auto _ : state) {
+    parallel_sort_dedupe(input, output, num_vertices, pool);
+    benchmark::DoNotOptimize(output.data());
+  }
+  
+  state.counters["Threads"] = num_threads;
+  state.counters["UniqueEdges"] = output.size();
+  set_construction_counters(state, input.size(), output.size() * sizeof(workloads::Edge));
+}
+BENCHMARK(BM_BoostGraphEdgeSortDedupe)
+  ->Apply(SortDedupeArgs)
+  ->Unit(benchmark::kMillisecond)
+  ->UseRealTime();
+
+// Large-scale tier: R-MAT power-law graphs far beyond cache sizes
+
+// Directed weighted graph used by the large-scale tier
+typedef boost::adjacency_list<
+  boost::vecS,
+  boost::vecS,
+  boost::directedS,
+  boost::no_property,
+  WeightedEdge
+> RmatGraph;
+
+// Process peak resident set size in bytes. This is a high-water mark since
+// process start, so it is only meaningful for the largest graph run so far.
+static double peak_rss_bytes() {
+  struct rusage usage;
+  getrusage(RUSAGE_SELF, &usage);
+#if defined(__APPLE__)
+  return static_cast<double>(usage.ru_maxrss);
+#else
+  return usage.ru_maxrss * 1024.0;
+#endif
+}
+
+// R-MAT graph plus the query source shared by the large-scale benchmarks
+struct RmatWorkload {
+  RmatGraph g;
+  boost::graph_traits<RmatGraph>::vertex_descriptor source; // Highest out-degree vertex
+  double edges_per_query; // Out-edges scanned by a full traversal from source
+};
+
+// Building the largest graphs takes far longer than one traversal, so the
+// most recent graph is kept across benchmark invocations. Every algorithm
+// runs on a scale before the next scale is built (see RmatArgs), so each
+// graph is built once and only one graph is alive at a time.
+static const RmatWorkload& rmat_workload(int scale, int edge_factor) {
+  static std::unique_ptr<RmatWorkload> workload;
+  static std::pair<int, int> workload_params;
+  
+  std::pair<int, int> params(scale, edge_factor);
+  if (!workload || workload_params != params) {
+    workload.reset();
+    workload.reset(new RmatWorkload);
+    workload_params = params;
+    
+    RmatGraph& g = workload->g;
+    g = RmatGraph(std::size_t(1) << scale);
+    for (const auto& edge : workloads::cached_rmat_edges(scale, edge_factor, 100)) {
+      boost::add_edge(edge.source, edge.target, WeightedEdge{edge.weight}, g);
+    }
+    
+    // R-MAT leaves many vertices isolated; start from the hub
+    workload->source = 0;
+    for (std::size_t v = 1; v < boost::num_vertices(g); ++v) {
+      if (boost::out_degree(v, g) > boost::out_degree(workload->source, g)) {
+        workload->source = v;
+      }
+    }
+    workload->edges_per_query = reachable_edge_count(g, workload->source);
+  }
+  return *workload;
+}
+
+enum RmatAlgorithm {
+  kRmatBFS = 0,  // breadth_first_search
+  kRmatDijkstra  // dijkstra_shortest_paths
+};
+
+// Arguments for the large-scale tier: {scale, edge factor, algorithm}, i.e.
+// 2^scale vertices and edge_factor * 2^scale edges. The algorithm is the
+// inner loop so consecutive runs share the cached graph. Graphs past 1e6
+// vertices need several GB of memory and are only registered when the
+// project is configured with -DBOOST_BENCH_LARGE_SCALE=ON.
+static void RmatArgs(benchmark::internal::Benchmark* b) {
+  std::vector<std::pair<int, int>> scales = {
+    {17, 16},   // 131k vertices, 2.1M edges
+#ifdef BOOST_BENCH_LARGE_SCALE
+    {20, 16},   // 1M vertices, 16.8M edges
+    {23, 16},   // 8.4M vertices, 134M edges
+    {24, 8},    // 16.8M vertices, 134M edges
+#endif
+  };
+  for (const auto& scale : scales) {
+    for (int algorithm : {kRmatBFS, kRmatDijkstra}) {
+      b->Args({scale.first, scale.second, algorithm});
+    }
+  }
+}
+
+// Report the large-scale counters shared by BFS and Dijkstra
+static void set_rmat_counters(benchmark::State& state, const RmatWorkload& workload) {
+  state.counters["Vertices"] = boost::num_vertices(workload.g);
+  state.counters["Edges"] = boost::num_edges(workload.g);
+  state.counters["TEPS"] = benchmark::Counter(
+    workload.edges_per_query * state.iterations(), benchmark::Counter::kIsRate);
+  state.counters["GraphBytes"] = benchmark::Counter(
+    adjacency_list_bytes(workload.g), benchmark::Counter::kDefaults, benchmark::Counter::OneK::kIs1024);
+  state.counters["PeakRSS"] = benchmark::Counter(
+    peak_rss_bytes(), benchmark::Counter::kDefaults, benchmark::Counter::OneK::kIs1024);
+}
+
+// Breadth-First Search and Dijkstra's shortest path on large R-MAT graphs
+static void BM_BoostGraphRmatTraversal(benchmark::State& state) {
+  const RmatWorkload& workload = rmat_workload(state.range(0), state.range(1));
+  const RmatGraph& g = workload.g;
+  const int algorithm = state.range(2);
+  
+  typedef boost::graph_traits<RmatGraph>::vertex_descriptor Vertex;
+  std::size_t num_vertices = boost::num_vertices(g);
+  
+  for (auto _ : state) {
+    if (algorithm == kRmatBFS) {
+      // Prepare data structures for BFS
+      std::vector<Vertex> predecessors(num_vertices,
+                                     boost::graph_traits<RmatGraph>::null_vertex());
+      std::vector<int> distances(num_vertices, -1);
+      
+      // Property maps
+      auto pred_map = boost::make_iterator_property_map(predecessors.begin(),
+                                                       boost::get(boost::vertex_index, g));
+      auto dist_map = boost::make_iterator_property_map(distances.begin(),
+                                                       boost::get(boost::vertex_index, g));
+      
+      // Run BFS
+      boost::breadth_first_search(g, workload.source,
+        boost::visitor(
+          boost::make_bfs_visitor(
+            std::make_pair(
+              boost::record_distances(dist_map, boost::on_tree_edge()),
+              boost::record_predecessors(pred_map, boost::on_tree_edge())
+            )
+          )
+        )
+      );
+      
+      benchmark::DoNotOptimize(distances);
+      benchmark::DoNotOptimize(predecessors);
+    } else {
+      // Vector for storing distances
+      std::vector<int> distances(num_vertices);
+      auto dist_map = boost::make_iterator_property_map(distances.begin(), boost::get(boost::vertex_index, g));
+      
+      // Vector for predecessors
+      std::vector<Vertex> predecessors(num_vertices);
+      auto pred_map = boost::make_iterator_property_map(predecessors.begin(), boost::get(boost::vertex_index, g));
+      
+      // Run Dijkstra's algorithm
+      boost::dijkstra_shortest_paths(g, workload.source,
+        boost::distance_map(dist_map).
+        predecessor_map(pred_map).
+        weight_map(boost::get(&WeightedEdge::weight, g)));
+      
+      benchmark::DoNotOptimize(distances);
+      benchmark::DoNotOptimize(predecessors);
+    }
+  }
+  
+  state.SetLabel(algorithm == kRmatBFS ? "BFS" : "Dijkstra");
+  set_rmat_counters(state, workload);
+}
+BENCHMARK(BM_BoostGraphRmatTraversal)
+  ->Apply(RmatArgs)
+  ->Unit(benchmark::kMillisecond);
+
 BENCHMARK_MAIN();
\ No newline at end of file
@@ -4,6 +4,9 @@
 #include <boost/multi_index/hashed_index.hpp>
 #include <boost/multi_index/member.hpp>
 #include <boost/multi_index/random_access_index.hpp>
+#include "common/allocation_tracker.hpp"
+#include "common/allocators.hpp"
+#include "common/workloads.hpp"
 #include <string>
 #include <vector>
 #include <map>
@@ -32,45 +35,30 @@ struct email {};
 struct age {};
 struct city {};
 
+// Indices maintained over Person
+typedef bmi::indexed_by<
+  bmi::ordered_unique<bmi::tag<id>, bmi::member<Person, int, &Person::id>>,
+  bmi::hashed_unique<bmi::tag<email>, bmi::member<Person, std::string, &Person::email>>,
+  bmi::ordered_non_unique<bmi::tag<name>, bmi::member<Person, std::string, &Person::name>>,
+  bmi::ordered_non_unique<bmi::tag<age>, bmi::member<Person, int, &Person::age>>,
+  bmi::ordered_non_unique<bmi::tag<city>, bmi::member<Person, std::string, &Person::city>>,
+  bmi::random_access<>
+> person_indices;
+
 // Boost.MultiIndex container with multiple indices
-typedef boost::multi_index_container<
-  Person,
-  bmi::indexed_by<
-    bmi::ordered_unique<bmi::tag<id>, bmi::member<Person, int, &Person::id>>,
-    bmi::hashed_unique<bmi::tag<email>, bmi::member<Person, std::string, &Person::email>>,
-    bmi::ordered_non_unique<bmi::tag<name>, bmi::member<Person, std::string, &Person::name>>,
-    bmi::ordered_non_unique<bmi::tag<age>, bmi::member<Person, int, &Person::age>>,
-    bmi::ordered_non_unique<bmi::tag<city>, bmi::member<Person, std::string, &Person::city>>,
-    bmi::random_access<>
-  >
-> person_multi_index;
+typedef boost::multi_index_container<Person, person_indices> person_multi_index;
 
-// Generate test data
-std::vector<Person> generatePersons(int count) {
-  std::vector<Person> persons;
-  persons.reserve(count);
-  
-  std::vector<std::string> names = {"John", "Mary", "Steve", "Jane", "Michael", "Sarah", "Robert", "Emily", "William", "Olivia"};
-  std::vector<std::string> cities = {"New York", "London", "Paris", "Tokyo", "Berlin", "Sydney", "Moscow", "Beijing", "Mumbai", "Rio"};
-  
-  for (int i = 0; i < count; ++i) {
-    int id = i;
-    std::string name = names[i % names.size()];
-    std::string email = name + std::to_string(i) + "@example.com";
-    int age = 20 + (i % 60); // ages 20-79
-    std::string city = cities[i % cities.size()];
-    
-    persons.emplace_back(id, name, email, age, city);
-  }
-  
-  return persons;
-}
+// The same container with the allocation strategy's allocator
+template <typename Allocation>
+using person_multi_index_alloc = boost::multi_index_container<
+  Person, person_indices, typename Allocation::template allocator<Person>>;
 
 // Benchmark for inserting into a multi_index_container
 static void BM_MultiIndexInsert(benchmark::State& state) {
   const int SIZE = state.range(0);
-  auto persons = generatePersons(SIZE);
+  auto persons = workloads::generate_persons<Person>(SIZE);
   
+  allocations::Tracker allocation_tracker;
   for (auto _ : state) {
     person_multi_index container;
     
@@ -81,6 +69,7 @@ static void BM_MultiIndexInsert(benchmark::State& state) {
     
     benchmark::DoNotOptimize(container);
   }
+  allocation_tracker.report(state);
   
   state.counters["Elements"] = SIZE;
 }
@@ -92,8 +81,9 @@ BENCHMARK(BM_MultiIndexInsert)
 // Comparison benchmark using standard containers
 static void BM_StandardContainersInsert(benchmark::State& state) {
   const int SIZE = state.range(0);
-  auto persons = generatePersons(SIZE);
+  auto persons = workloads::generate_persons<Person>(SIZE);
   
+  allocations::Tracker allocation_tracker;
   for (auto _ : state) {
     // Create separate data structures for each index
     std::map<int, size_t> id_index;
@@ -128,6 +118,7 @@ static void BM_StandardContainersInsert(benchmark::State& state) {
     benchmark::DoNotOptimize(city_index);
     benchmark::DoNotOptimize(name_city_index);
   }
+  allocation_tracker.report(state);
   
   state.counters["Elements"] = SIZE;
 }
@@ -136,10 +127,113 @@ BENCHMARK(BM_StandardContainersInsert)
   ->Arg(1000)    // Medium dataset
   ->Arg(10000);  // Large dataset
 
+// Insert benchmarks with the allocation strategy as a template parameter.
+// Only container nodes and buckets go through the strategy; the Person
+// strings keep the default allocator.
+template <typename Allocation>
+static void BM_MultiIndexInsertAllocator(benchmark::State& state) {
+  const int SIZE = state.range(0);
+  auto persons = workloads::generate_persons<Person>(SIZE);
+  
+  allocations::Tracker allocation_tracker;
+  for (auto _ : state) {
+    Allocation allocation;
+    person_multi_index_alloc<Allocation> container(allocation.template get<Person>());
+    
+    // Insert all persons
+    for (const auto& person : persons) {
+      container.insert(person);
+    }
+    
+    benchmark::DoNotOptimize(container);
+  }
+  allocators::report<Allocation>(allocation_tracker, state);
+  
+  state.counters["Elements"] = SIZE;
+}
+BENCHMARK_TEMPLATE(BM_MultiIndexInsertAllocator, allocators::Std)
+  ->Arg(100)->Arg(1000)->Arg(10000);
+BENCHMARK_TEMPLATE(BM_MultiIndexInsertAllocator, allocators::Monotonic)
+  ->Arg(100)->Arg(1000)->Arg(10000);
+BENCHMARK_TEMPLATE(BM_MultiIndexInsertAllocator, allocators::UnsynchronizedPool)
+  ->Arg(100)->Arg(1000)->Arg(10000);
+BENCHMARK_TEMPLATE(BM_MultiIndexInsertAllocator, allocators::AdaptivePool)
+  ->Arg(100)->Arg(1000)->Arg(10000);
+BENCHMARK_TEMPLATE(BM_MultiIndexInsertAllocator, allocators::NodePool)
+  ->Arg(100)->Arg(1000)->Arg(10000);
+
+template <typename Allocation>
+static void BM_StandardContainersInsertAllocator(benchmark::State& state) {
+  const int SIZE = state.range(0);
+  auto persons = workloads::generate_persons<Person>(SIZE);
+  
+  typedef std::pair<const int, size_t> int_entry;
+  typedef std::pair<const std::string, size_t> string_entry;
+  typedef std::pair<const std::pair<std::string, std::string>, size_t> name_city_entry;
+  typedef typename Allocation::template allocator<int_entry> int_allocator;
+  typedef typename Allocation::template allocator<string_entry> string_allocator;
+  
+  allocations::Tracker allocation_tracker;
+  for (auto _ : state) {
+    Allocation allocation;
+    
+    // Create separate data structures for each index
+    std::map<int, size_t, std::less<int>, int_allocator> id_index(allocation.template get<int_entry>());
+    std::unordered_map<std::string, size_t, std::hash<std::string>, std::equal_to<std::string>, string_allocator>
+      email_index(0, std::hash<std::string>(), std::equal_to<std::string>(), allocation.template get<string_entry>());
+    std::multimap<std::string, size_t, std::less<std::string>, string_allocator>
+      name_index(allocation.template get<string_entry>());
+    std::multimap<int, size_t, std::less<int>, int_allocator> age_index(allocation.template get<int_entry>());
+    std::multimap<std::string, size_t, std::less<std::string>, string_allocator>
+      city_index(allocation.template get<string_entry>());
+    std::multimap<std::pair<std::string, std::string>, size_t, std::less<std::pair<std::string, std::string>>,
+                  typename Allocation::template allocator<name_city_entry>>
+      name_city_index(allocation.template get<name_city_entry>());
+    std::vector<Person, typename Allocation::template allocator<Person>> data(allocation.template get<Person>());
+    
+    // Insert all persons
+    for (size_t i = 0; i < persons.size(); ++i) {
+      const auto& person = persons[i];
+      
+      // Store in vector
+      data.push_back(person);
+      
+      // Update indices
+      id_index[person.id] = i;
+      email_index[person.email] = i;
+      name_index.emplace(person.name, i);
+      age_index.emplace(person.age, i);
+      city_index.emplace(person.city, i);
+      name_city_index.emplace(std::make_pair(person.name, person.city), i);
+    }
+    
+    benchmark::DoNotOptimize(data);
+    benchmark::DoNotOptimize(id_index);
+    benchmark::DoNotOptimize(email_index);
+    benchmark::DoNotOptimize(name_index);
+    benchmark::DoNotOptimize(age_index);
+    benchmark::DoNotOptimize(city_index);
+    benchmark::DoNotOptimize(name_city_index);
+  }
+  allocators::report<Allocation>(allocation_tracker, state);
+  
+  state.counters["Elements"] = SIZE;
+}
+BENCHMARK_TEMPLATE(BM_StandardContainersInsertAllocator, allocators::Std)
+  ->Arg(100)->Arg(1000)->Arg(10000);
+BENCHMARK_TEMPLATE(BM_StandardContainersInsertAllocator, allocators::Monotonic)
+  ->Arg(100)->Arg(1000)->Arg(10000);
+BENCHMARK_TEMPLATE(BM_StandardContainersInsertAllocator, allocators::UnsynchronizedPool)
+  ->Arg(100)->Arg(1000)->Arg(10000);
+BENCHMARK_TEMPLATE(BM_StandardContainersInsertAllocator, allocators::AdaptivePool)
+  ->Arg(100)->Arg(1000)->Arg(10000);
+BENCHMARK_TEMPLATE(BM_StandardContainersInsertAllocator, allocators::NodePool)
+  ->Arg(100)->Arg(1000)->Arg(10000);
+
 // Benchmark for lookup by different indices
 static void BM_MultiIndexLookupById(benchmark::State& state) {
   const int SIZE = state.range(0);
-  auto persons = generatePersons(SIZE);
+  auto persons = workloads::generate_persons<Person>(SIZE);
   
   // Prepare container
   person_multi_index container;
@@ -148,10 +242,7 @@ static void BM_MultiIndexLookupById(benchmark::State& state) {
   }
   
   // Prepare lookup keys
-  std::vector<int> lookup_ids;
-  for (int i = 0; i < 100; ++i) {
-    lookup_ids.push_back(rand() % SIZE);
-  }
+  std::vector<int> lookup_ids = workloads::random_indices(100, SIZE);
   
   for (auto _ : state) {
     int sum = 0;
@@ -176,7 +267,7 @@ BENCHMARK(BM_MultiIndexLookupById)
 
 static void BM_MultiIndexLookupByEmail(benchmark::State& state) {
   const int SIZE = state.range(0);
-  auto persons = generatePersons(SIZE);
+  auto persons = workloads::generate_persons<Person>(SIZE);
   
   // Prepare container
   person_multi_index container;
@@ -186,8 +277,7 @@ static void BM_MultiIndexLookupByEmail(benchmark::State& state) {
   
   // Prepare lookup keys
   std::vector<std::string> lookup_emails;
-  for (int i = 0; i < 100; ++i) {
-    int idx = rand() % SIZE;
+  for (int idx : workloads::random_indices(100, SIZE)) {
     lookup_emails.push_back(persons[idx].email);
   }
   
@@ -214,7 +304,7 @@ BENCHMARK(BM_MultiIndexLookupByEmail)
 
 static void BM_MultiIndexRangeByAge(benchmark::State& state) {
   const int SIZE = state.range(0);
-  auto persons = generatePersons(SIZE);
+  auto persons = workloads::generate_persons<Person>(SIZE);
   
   // Prepare container
   person_multi_index container;
@@ -258,11 +348,16 @@ BENCHMARK(BM_MultiIndexRangeByAge)
 // Benchmark for modification operations with reindexing
 static void BM_MultiIndexModify(benchmark::State& state) {
   const int SIZE = state.range(0);
-  auto persons = generatePersons(SIZE);
+  auto persons = workloads::generate_persons<Person>(SIZE);
   
   // Number of modifications to perform
   int mod_count = state.range(1);
   
+  // Records to modify and the suffixes of their new name and city
+  std::vector<int> ids_to_modify = workloads::random_indices(mod_count, SIZE);
+  std::vector<int> suffixes = workloads::random_indices(2 * mod_count, 1000, workloads::default_seed() + 1);
+  
+  allocations::Tracker allocation_tracker;
   for (auto _ : state) {
     // Prepare container
     person_multi_index container;
@@ -274,20 +369,21 @@ static void BM_MultiIndexModify(benchmark::State& state) {
     
     // Perform modifications (changing name and city which affects multiple indices)
     for (int i = 0; i < mod_count; ++i) {
-      int id_to_modify = rand() % SIZE;
+      int id_to_modify = ids_to_modify[i];
       auto it = id_index.find(id_to_modify);
       
       if (it != id_index.end()) {
         // Modify the record - this will update all indices
-        id_index.modify(it, [](Person& p) {
-          p.name = "Modified" + std::to_string(rand() % 1000);
-          p.city = "NewCity" + std::to_string(rand() % 1000);
+        id_index.modify(it, [&](Person& p) {
+          p.name = "Modified" + std::to_string(suffixes[2 * i]);
+          p.city = "NewCity" + std::to_string(suffixes[2 * i + 1]);
         });
       }
     }
     
     benchmark::DoNotOptimize(container);
   }
+  allocation_tracker.report(state);
   
   state.counters["Elements"] = SIZE;
   state.counters["Modifications"] = mod_count;
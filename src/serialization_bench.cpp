@@ -14,6 +14,8 @@
 #include <boost/archive/binary_iarchive.hpp>
 #include <boost/archive/xml_oarchive.hpp>
 #include <boost/archive/xml_iarchive.hpp>
+#include "common/allocation_tracker.hpp"
+#include "common/workloads.hpp"
 #include <sstream>
 #include <string>
 #include <vector>
@@ -91,43 +93,12 @@ public:
 
 BOOST_CLASS_VERSION(ComplexData, 1)
 
-// Generate complex test data with parameterized size
-ComplexData generateComplexData(int size) {
-    ComplexData data(1234, "TestObject");
-    
-    // Add values
-    for (int i = 0; i < size; ++i) {
-        data.addValue(i * 3.14159);
-    }
-    
-    // Add properties
-    for (int i = 0; i < size / 2; ++i) {
-        data.addProperty("prop_" + std::to_string(i), i * 10);
-    }
-    
-    // Add tags
-    for (int i = 0; i < size / 3; ++i) {
-        data.addTag("tag_" + std::to_string(i));
-    }
-    
-    // Add nested data
-    for (int i = 0; i < size / 5; ++i) {
-        std::vector<std::string> strings;
-        for (int j = 0; j < 3; ++j) {
-            strings.push_back("nested_" + std::to_string(i) + "_" + std::to_string(j));
-        }
-        data.addNestedData(i, strings);
-    }
-    
-    return data;
-}
-
 // Generate a vector of complex data for bulk serialization
 std::vector<ComplexData> generateDataVector(int count, int itemSize) {
     std::vector<ComplexData> dataVector;
     
     for (int i = 0; i < count; ++i) {
-        dataVector.push_back(generateComplexData(itemSize));
+        dataVector.push_back(workloads::generate_complex_data<ComplexData>(itemSize));
     }
     
     return dataVector;
@@ -141,6 +112,7 @@ static void BM_BoostSerializationText(benchmark::State& state) {
     // Generate test data
     auto testData = generateDataVector(item_count, item_size);
     
+    allocations::Tracker allocation_tracker;
     for (auto _ : state) {
         std::ostringstream oss;
         
@@ -163,6 +135,7 @@ static void BM_BoostSerializationText(benchmark::State& state) {
         
         benchmark::DoNotOptimize(loadedData);
     }
+    allocation_tracker.report(state);
     
     state.counters["ItemCount"] = item_count;
     state.counters["ItemSize"] = item_size;
@@ -180,6 +153,7 @@ static void BM_BoostSerializationBinary(benchmark::State& state) {
     // Generate test data
     auto testData = generateDataVector(item_count, item_size);
     
+    allocations::Tracker allocation_tracker;
     for (auto _ : state) {
         std::ostringstream oss;
         
@@ -202,6 +176,7 @@ static void BM_BoostSerializationBinary(benchmark::State& state) {
         
         benchmark::DoNotOptimize(loadedData);
     }
+    allocation_tracker.report(state);
     
     state.counters["ItemCount"] = item_count;
     state.counters["ItemSize"] = item_size;
@@ -219,6 +194,7 @@ static void BM_BoostSerializationXML(benchmark::State& state) {
     // Generate test data
     auto testData = generateDataVector(item_count, item_size);
     
+    allocations::Tracker allocation_tracker;
     for (auto _ : state) {
         std::ostringstream oss;
         
@@ -241,6 +217,7 @@ static void BM_BoostSerializationXML(benchmark::State& state) {
         
         benchmark::DoNotOptimize(loadedData);
     }
+    allocation_tracker.report(state);
     
     state.counters["ItemCount"] = item_count;
     state.counters["ItemSize"] = item_size;
@@ -256,8 +233,9 @@ static void BM_BoostSerializationCompareFormats(benchmark::State& state) {
     int size = state.range(1);
     
     // Generate a single complex object
-    auto testData = generateComplexData(size);
+    auto testData = workloads::generate_complex_data<ComplexData>(size);
     
+    allocations::Tracker allocation_tracker;
     for (auto _ : state) {
         std::ostringstream oss;
         
@@ -283,6 +261,7 @@ static void BM_BoostSerializationCompareFormats(benchmark::State& state) {
         std::string serialized = oss.str();
         benchmark::DoNotOptimize(serialized);
     }
+    allocation_tracker.report(state);
     
     std::string format_name;
     switch (format) {
@@ -1,35 +1,228 @@
 #include <benchmark/benchmark.h>
 #include <boost/algorithm/string.hpp>
+#include <boost/container/pmr/monotonic_buffer_resource.hpp>
+#include <boost/container/string.hpp>
 #include <boost/lexical_cast.hpp>
 #include <boost/regex.hpp>
+#include <boost/xpressive/xpressive_static.hpp>
 #include <boost/format.hpp>
+#include <boost/spirit/include/qi.hpp>
+#include <boost/version.hpp>
+#if BOOST_VERSION >= 108500
+#include <boost/charconv.hpp>
+#endif
+#include <fmt/compile.h>
+#include <fmt/format.h>
+#include "common/allocation_tracker.hpp"
+#include "common/workloads.hpp"
+#include <charconv>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iterator>
+#include <map>
+#include <sstream>
 #include <string>
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
-// Benchmark for boost::algorithm::split
-static void BM_BoostStringSplit(benchmark::State& state) {
-  // Create input string based on the range_x parameter (number of items to split)
-  int item_count = state.range(0);
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define BOOST_BENCH_X86_SIMD 1
+#endif
+
+// Comma separated line of item_count tokens: "item0,item1,..."
+static std::string split_input(int item_count) {
   std::string input;
   for (int i = 0; i < item_count; i++) {
     input += "item" + std::to_string(i);
     if (i < item_count - 1) input += ",";
   }
+  return input;
+}
+
+static void set_split_counters(benchmark::State& state, std::size_t bytes, std::size_t tokens) {
+  state.counters["BytesPerSecond"] = benchmark::Counter(
+    static_cast<double>(bytes) * state.iterations(), benchmark::Counter::kIsRate,
+    benchmark::Counter::OneK::kIs1024);
+  state.counters["Tokens"] = tokens;
+}
+
+// Benchmark for boost::algorithm::split
+static void BM_BoostStringSplit(benchmark::State& state) {
+  // Create input string based on the range_x parameter (number of items to split)
+  int item_count = state.range(0);
+  std::string input = split_input(item_count);
   
   std::vector<std::string> results;
   
+  allocations::Tracker allocation_tracker;
   for (auto _ : state) {
     results.clear();
     boost::algorithm::split(results, input, boost::is_any_of(","));
     benchmark::DoNotOptimize(results);
   }
+  allocation_tracker.report(state);
   
   state.counters["ItemCount"] = item_count;
+  set_split_counters(state, input.size(), results.size());
 }
 BENCHMARK(BM_BoostStringSplit)
-  ->Arg(5)    // Small list
-  ->Arg(50)   // Medium list
-  ->Arg(500); // Large list
+  ->Arg(5)       // Small list
+  ->Arg(50)      // Medium list
+  ->Arg(500)     // Large list
+  ->Arg(100000); // Megabyte line
+
+// Split into views of the input instead of owning strings. The token
+// vector is reused, so the hand-written engines do not touch the heap once
+// it has grown; boost::algorithm::split still copies the is_any_of set and
+// builds a temporary vector per call. Every engine produces the same tokens
+// as boost::algorithm::split, including empty tokens between adjacent
+// delimiters.
+
+enum SplitEngine {
+  kSplitBoostRange = 0, // boost::algorithm::split into iterator_range tokens
+  kSplitMemchr,         // memchr from one delimiter to the next
+  kSplitSse2,           // 16-byte compare + movemask delimiter scan
+  kSplitAvx2            // 32-byte compare + movemask delimiter scan
+};
+
+typedef boost::iterator_range<std::string::const_iterator> TokenRange;
+
+static void split_memchr(std::string_view input, char delimiter,
+                         std::vector<std::string_view>& tokens) {
+  const char* data = input.data();
+  const char* end = data + input.size();
+  const char* start = data;
+  while (const char* hit = static_cast<const char*>(std::memchr(start, delimiter, end - start))) {
+    tokens.emplace_back(start, hit - start);
+    start = hit + 1;
+  }
+  tokens.emplace_back(start, end - start);
+}
+
+#ifdef BOOST_BENCH_X86_SIMD
+// Emits the tokens ending at each set bit of a delimiter mask for the
+// block starting at offset and returns the new token start
+template <typename Mask>
+static inline std::size_t emit_delimiters(const char* data, std::size_t offset, Mask mask,
+                                          std::size_t start, std::vector<std::string_view>& tokens) {
+  while (mask) {
+    std::size_t position = offset + __builtin_ctz(mask);
+    tokens.emplace_back(data + start, position - start);
+    start = position + 1;
+    mask &= mask - 1;
+  }
+  return start;
+}
+
+static void split_tail(const char* data, std::size_t size, std::size_t i, std::size_t start,
+                       char delimiter, std::vector<std::string_view>& tokens) {
+  for (; i < size; ++i) {
+    if (data[i] == delimiter) {
+      tokens.emplace_back(data + start, i - start);
+      start = i + 1;
+    }
+  }
+  tokens.emplace_back(data + start, size - start);
+}
+
+static void split_sse2(std::string_view input, char delimiter,
+                       std::vector<std::string_view>& tokens) {
+  const char* data = input.data();
+  const std::size_t size = input.size();
+  const __m128i needle = _mm_set1_epi8(delimiter);
+  std::size_t start = 0;
+  std::size_t i = 0;
+  for (; i + 16 <= size; i += 16) {
+    __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+    unsigned mask = _mm_movemask_epi8(_mm_cmpeq_epi8(block, needle));
+    start = emit_delimiters(data, i, mask, start, tokens);
+  }
+  split_tail(data, size, i, start, delimiter, tokens);
+}
+
+__attribute__((target("avx2")))
+static void split_avx2(std::string_view input, char delimiter,
+                       std::vector<std::string_view>& tokens) {
+  const char* data = input.data();
+  const std::size_t size = input.size();
+  const __m256i needle = _mm256_set1_epi8(delimiter);
+  std::size_t start = 0;
+  std::size_t i = 0;
+  for (; i + 32 <= size; i += 32) {
+    __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+    unsigned mask = static_cast<unsigned>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(block, needle)));
+    start = emit_delimiters(data, i, mask, start, tokens);
+  }
+  split_tail(data, size, i, start, delimiter, tokens);
+}
+#endif
+
+static void BM_StringSplitView(benchmark::State& state) {
+  int item_count = state.range(0);
+  const int engine = state.range(1);
+  std::string input = split_input(item_count);
+  
+#ifdef BOOST_BENCH_X86_SIMD
+  if (engine == kSplitAvx2 && !__builtin_cpu_supports("avx2")) {
+    state.SkipWithError("AVX2 not supported on this CPU");
+    return;
+  }
+#else
+  if (engine == kSplitSse2 || engine == kSplitAvx2) {
+    state.SkipWithError("x86 SIMD not available on this target");
+    return;
+  }
+#endif
+  
+  std::vector<TokenRange> ranges;
+  std::vector<std::string_view> tokens;
+  
+  allocations::Tracker allocation_tracker;
+  for (auto _ : state) {
+    switch (engine) {
+      case kSplitBoostRange:
+        ranges.clear();
+        boost::algorithm::split(ranges, input, boost::is_any_of(","));
+        benchmark::DoNotOptimize(ranges.data());
+        break;
+      case kSplitMemchr:
+        tokens.clear();
+        split_memchr(input, ',', tokens);
+        break;
+#ifdef BOOST_BENCH_X86_SIMD
+      case kSplitSse2:
+        tokens.clear();
+        split_sse2(input, ',', tokens);
+        break;
+      case kSplitAvx2:
+        tokens.clear();
+        split_avx2(input, ',', tokens);
+        break;
+#endif
+    }
+    benchmark::DoNotOptimize(tokens.data());
+    benchmark::ClobberMemory();
+  }
+  allocation_tracker.report(state);
+  
+  state.counters["ItemCount"] = item_count;
+  set_split_counters(state, input.size(), engine == kSplitBoostRange ? ranges.size() : tokens.size());
+}
+// Arguments: {item count, engine}
+static void SplitViewArgs(benchmark::internal::Benchmark* b) {
+  for (int engine : {kSplitBoostRange, kSplitMemchr, kSplitSse2, kSplitAvx2}) {
+    for (int item_count : {5, 50, 500, 100000}) {
+      b->Args({item_count, engine});
+    }
+  }
+}
+BENCHMARK(BM_StringSplitView)->Apply(SplitViewArgs);
 
 // Benchmark for boost::lexical_cast
 static void BM_BoostLexicalCast(benchmark::State& state) {
@@ -46,10 +239,12 @@ static void BM_BoostLexicalCast(benchmark::State& state) {
     input = "2000000000";  // Largest safe value for int32
   }
   
+  allocations::Tracker allocation_tracker;
   for (auto _ : state) {
     int result = boost::lexical_cast<int>(input);
     benchmark::DoNotOptimize(result);
   }
+  allocation_tracker.report(state);
   
   state.counters["DigitCount"] = digit_count;
 }
@@ -65,10 +260,12 @@ static void BM_BoostLexicalCastFloat(benchmark::State& state) {
   std::string input = "123.";
   input += std::string(precision, '9');
   
+  allocations::Tracker allocation_tracker;
   for (auto _ : state) {
     float result = boost::lexical_cast<float>(input);
     benchmark::DoNotOptimize(result);
   }
+  allocation_tracker.report(state);
   
   state.counters["Precision"] = precision;
 }
@@ -77,6 +274,117 @@ BENCHMARK(BM_BoostLexicalCastFloat)
   ->Arg(6)    // Medium precision
   ->Arg(10);  // High precision
 
+// Bulk numeric parsing over one CSV column of varied-length numbers, so the
+// branch predictors cannot learn a single input. Every number is parsed
+// once per iteration and must be consumed completely.
+
+struct LexicalCastParser {
+  template <typename T>
+  static bool parse(const char* first, const char* last, T& value) {
+    return boost::conversion::try_lexical_convert(first, last - first, value);
+  }
+};
+
+struct StdFromCharsParser {
+  template <typename T>
+  static bool parse(const char* first, const char* last, T& value) {
+    std::from_chars_result result = std::from_chars(first, last, value);
+    return result.ec == std::errc() && result.ptr == last;
+  }
+};
+
+#if BOOST_VERSION >= 108500
+struct BoostCharconvParser {
+  template <typename T>
+  static bool parse(const char* first, const char* last, T& value) {
+    boost::charconv::from_chars_result result = boost::charconv::from_chars(first, last, value);
+    return result.ec == std::errc() && result.ptr == last;
+  }
+};
+#endif
+
+struct SpiritQiParser {
+  static bool parse(const char* first, const char* last, std::int64_t& value) {
+    return boost::spirit::qi::parse(first, last, boost::spirit::qi::long_long, value) && first == last;
+  }
+  static bool parse(const char* first, const char* last, double& value) {
+    return boost::spirit::qi::parse(first, last, boost::spirit::qi::double_, value) && first == last;
+  }
+};
+
+// strtoll/strtod stop at the newline terminating each number
+struct StrtodParser {
+  static bool parse(const char* first, const char* last, std::int64_t& value) {
+    char* end;
+    value = std::strtoll(first, &end, 10);
+    return end == last;
+  }
+  static bool parse(const char* first, const char* last, double& value) {
+    char* end;
+    value = std::strtod(first, &end);
+    return end == last;
+  }
+};
+
+template <typename T, typename Parser>
+static void BM_BulkNumberParse(benchmark::State& state) {
+  const std::size_t count = state.range(0);
+  const std::string text = workloads::numeric_text(std::is_floating_point<T>::value, count);
+  
+  std::vector<std::pair<const char*, const char*>> numbers;
+  numbers.reserve(count);
+  for (const char* first = text.data(); first != text.data() + text.size();) {
+    const char* last = static_cast<const char*>(std::memchr(first, '\n', text.data() + text.size() - first));
+    numbers.emplace_back(first, last);
+    first = last + 1;
+  }
+  
+  bool parsed = true;
+  for (auto _ : state) {
+    for (const auto& number : numbers) {
+      T value;
+      parsed &= Parser::parse(number.first, number.second, value);
+      benchmark::DoNotOptimize(value);
+    }
+    if (!parsed) {
+      state.SkipWithError("Number not fully parsed");
+      break;
+    }
+  }
+  
+  state.counters["Numbers"] = count;
+  state.counters["NumbersPerSecond"] = benchmark::Counter(
+    static_cast<double>(count) * state.iterations(), benchmark::Counter::kIsRate);
+  state.counters["BytesPerSecond"] = benchmark::Counter(
+    static_cast<double>(text.size()) * state.iterations(), benchmark::Counter::kIsRate,
+    benchmark::Counter::OneK::kIs1024);
+}
+
+#define BULK_NUMBER_PARSE(T, Parser)                  \
+  BENCHMARK_TEMPLATE(BM_BulkNumberParse, T, Parser)   \
+    ->Arg(10000)    /* Cache-resident column */       \
+    ->Arg(1000000)  /* Multi-megabyte column */       \
+    ->Unit(benchmark::kMicrosecond)
+
+BULK_NUMBER_PARSE(std::int64_t, LexicalCastParser);
+BULK_NUMBER_PARSE(std::int64_t, StdFromCharsParser);
+#if BOOST_VERSION >= 108500
+BULK_NUMBER_PARSE(std::int64_t, BoostCharconvParser);
+#endif
+BULK_NUMBER_PARSE(std::int64_t, SpiritQiParser);
+BULK_NUMBER_PARSE(std::int64_t, StrtodParser);
+
+BULK_NUMBER_PARSE(double, LexicalCastParser);
+#if defined(__cpp_lib_to_chars)
+// Floating-point std::from_chars is missing from older standard libraries
+BULK_NUMBER_PARSE(double, StdFromCharsParser);
+#endif
+#if BOOST_VERSION >= 108500
+BULK_NUMBER_PARSE(double, BoostCharconvParser);
+#endif
+BULK_NUMBER_PARSE(double, SpiritQiParser);
+BULK_NUMBER_PARSE(double, StrtodParser);
+
 // Benchmark for boost::regex
 static void BM_BoostRegex(benchmark::State& state) {
   // Create input text based on parameter
@@ -96,12 +404,14 @@ static void BM_BoostRegex(benchmark::State& state) {
   
   boost::regex email_pattern(R"([a-zA-Z0-9._%+-]+@[a-zA-Z0-9.-]+\.[a-zA-Z]{2,})");
   
+  allocations::Tracker allocation_tracker;
   for (auto _ : state) {
     boost::smatch match;
     bool result = boost::regex_search(input, match, email_pattern);
     benchmark::DoNotOptimize(result);
     benchmark::DoNotOptimize(match);
   }
+  allocation_tracker.report(state);
   
   state.counters["TextSize"] = text_size;
 }
@@ -110,6 +420,221 @@ BENCHMARK(BM_BoostRegex)
   ->Arg(1000)    // Medium text
   ->Arg(10000);  // Large text
 
+// Multi-pattern scanning: count every match of a set of personal-data
+// patterns across a multi-megabyte log corpus, as a log scrubber does.
+// The pattern set is a bitmask of PiiPattern values.
+
+enum PiiPattern {
+  kEmailPattern = 1,
+  kPhonePattern = 2,
+  kIpv4Pattern = 4,
+  kUuidPattern = 8,
+  kAllPatterns = 15
+};
+
+enum ScanEngine {
+  kScanPerPattern = 0, // One boost::sregex_iterator pass per pattern
+  kScanAlternation,    // One pass with all patterns combined by alternation
+  kScanXpressive,      // One pass with a static xpressive alternation
+  kScanPrefilter       // SIMD scan for anchor bytes, alternation on hit lines only
+};
+
+struct PiiPatternInfo {
+  PiiPattern pattern;
+  const char* regex;
+  char anchor; // Byte every match contains
+};
+
+static const PiiPatternInfo pii_patterns[] = {
+  {kEmailPattern, R"([A-Za-z0-9._%+-]+@[A-Za-z0-9.-]+\.[A-Za-z]{2,})", '@'},
+  {kPhonePattern, R"(\b\d{3}-\d{3}-\d{4}\b)", '-'},
+  {kIpv4Pattern, R"(\b(?:\d{1,3}\.){3}\d{1,3}\b)", '.'},
+  {kUuidPattern, R"(\b[0-9a-fA-F]{8}-[0-9a-fA-F]{4}-[0-9a-fA-F]{4}-[0-9a-fA-F]{4}-[0-9a-fA-F]{12}\b)", '-'},
+};
+
+// Static xpressive equivalents of pii_patterns. combined[i] is the
+// alternation of the selected patterns among the first i + 1; the nested
+// regexes are held by reference, so the array must not move.
+struct XpressivePatterns {
+  explicit XpressivePatterns(int pattern_set) {
+    using namespace boost::xpressive;
+    const sregex patterns[] = {
+      +set[alnum | '.' | '_' | '%' | '+' | '-'] >> '@' >> +set[alnum | '.' | '-'] >> '.' >> repeat<2, inf>(alpha),
+      _b >> repeat<3>(_d) >> '-' >> repeat<3>(_d) >> '-' >> repeat<4>(_d) >> _b,
+      _b >> repeat<3>(repeat<1, 3>(_d) >> '.') >> repeat<1, 3>(_d) >> _b,
+      _b >> repeat<8>(xdigit) >> '-' >> repeat<4>(xdigit) >> '-' >> repeat<4>(xdigit) >> '-' >>
+        repeat<4>(xdigit) >> '-' >> repeat<12>(xdigit) >> _b,
+    };
+    int last = -1;
+    for (int i = 0; i < 4; ++i) {
+      if (pattern_set & pii_patterns[i].pattern) {
+        selected[i] = patterns[i];
+        combined[i] = last < 0 ? selected[i] : (combined[last] | selected[i]);
+        last = i;
+      }
+    }
+    if (last >= 0) {
+      regex = combined[last];
+    }
+  }
+  
+  boost::xpressive::sregex selected[4];
+  boost::xpressive::sregex combined[4];
+  boost::xpressive::sregex regex;
+};
+
+#ifdef BOOST_BENCH_X86_SIMD
+// Position of the first byte at or after from that is one of anchors, or size
+static std::size_t find_anchor(const char* data, std::size_t size, std::size_t from,
+                               const std::string& anchors) {
+  __m128i needles[4];
+  for (std::size_t a = 0; a < anchors.size(); ++a) {
+    needles[a] = _mm_set1_epi8(anchors[a]);
+  }
+  std::size_t i = from;
+  for (; i + 16 <= size; i += 16) {
+    __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+    __m128i hits = _mm_setzero_si128();
+    for (std::size_t a = 0; a < anchors.size(); ++a) {
+      hits = _mm_or_si128(hits, _mm_cmpeq_epi8(block, needles[a]));
+    }
+    if (unsigned mask = _mm_movemask_epi8(hits)) {
+      return i + __builtin_ctz(mask);
+    }
+  }
+  for (; i < size; ++i) {
+    if (anchors.find(data[i]) != std::string::npos) {
+      return i;
+    }
+  }
+  return size;
+}
+#endif
+
+// Every engine compiled for one pattern set. count() returns the number of
+// matches one engine finds in corpus.
+struct MultiPatternScanner {
+  explicit MultiPatternScanner(int pattern_set) : xpressive_patterns(pattern_set) {
+    std::string alternation;
+    for (const PiiPatternInfo& info : pii_patterns) {
+      if (pattern_set & info.pattern) {
+        regexes.emplace_back(info.regex);
+        alternation += (alternation.empty() ? "(?:" : "|(?:") + std::string(info.regex) + ")";
+        if (anchors.find(info.anchor) == std::string::npos) {
+          anchors += info.anchor;
+        }
+      }
+    }
+    combined.assign(alternation);
+  }
+  
+  std::size_t count(int engine, const std::string& corpus) const {
+    std::size_t matches = 0;
+    switch (engine) {
+      case kScanPerPattern:
+        for (const boost::regex& regex : regexes) {
+          for (boost::sregex_iterator it(corpus.begin(), corpus.end(), regex), end; it != end; ++it) {
+            ++matches;
+          }
+        }
+        break;
+      case kScanAlternation:
+        for (boost::sregex_iterator it(corpus.begin(), corpus.end(), combined), end; it != end; ++it) {
+          ++matches;
+        }
+        break;
+      case kScanXpressive:
+        for (boost::xpressive::sregex_iterator it(corpus.begin(), corpus.end(), xpressive_patterns.regex), end;
+             it != end; ++it) {
+          ++matches;
+        }
+        break;
+#ifdef BOOST_BENCH_X86_SIMD
+      case kScanPrefilter: {
+        // Patterns never span lines, so only lines holding an anchor byte
+        // need the regex
+        const char* data = corpus.data();
+        std::size_t position = 0;
+        while ((position = find_anchor(data, corpus.size(), position, anchors)) < corpus.size()) {
+          std::size_t line_begin = corpus.rfind('\n', position);
+          line_begin = line_begin == std::string::npos ? 0 : line_begin + 1;
+          std::size_t line_end = corpus.find('\n', position);
+          line_end = line_end == std::string::npos ? corpus.size() : line_end;
+          for (boost::cregex_iterator it(data + line_begin, data + line_end, combined), end; it != end; ++it) {
+            ++matches;
+          }
+          position = line_end;
+        }
+        break;
+      }
+#endif
+    }
+    return matches;
+  }
+  
+  std::vector<boost::regex> regexes;
+  boost::regex combined;
+  XpressivePatterns xpressive_patterns;
+  std::string anchors;
+};
+
+static void BM_BoostRegexMultiPattern(benchmark::State& state) {
+  const std::size_t corpus_size = state.range(0);
+  const int pattern_set = state.range(1);
+  const int engine = state.range(2);
+  
+  if ((pattern_set & kAllPatterns) == 0) {
+    state.SkipWithError("pattern set selects no patterns");
+    return;
+  }
+#ifndef BOOST_BENCH_X86_SIMD
+  if (engine == kScanPrefilter) {
+    state.SkipWithError("x86 SIMD not available on this target");
+    return;
+  }
+#endif
+  
+  const std::string corpus = workloads::log_text(corpus_size);
+  const MultiPatternScanner scanner(pattern_set);
+  
+  // Every engine must find the same matches, or the timings are not
+  // comparable
+  const std::size_t expected = scanner.count(kScanPerPattern, corpus);
+  std::vector<int> engines = {kScanAlternation, kScanXpressive};
+#ifdef BOOST_BENCH_X86_SIMD
+  engines.push_back(kScanPrefilter);
+#endif
+  for (int other : engines) {
+    if (scanner.count(other, corpus) != expected) {
+      state.SkipWithError("scan engines disagree on the match count");
+      return;
+    }
+  }
+  
+  std::size_t matches = 0;
+  for (auto _ : state) {
+    matches = scanner.count(engine, corpus);
+    benchmark::DoNotOptimize(matches);
+  }
+  
+  state.counters["Matches"] = matches;
+  state.counters["Patterns"] = scanner.regexes.size();
+  state.counters["BytesPerSecond"] = benchmark::Counter(
+    static_cast<double>(corpus.size()) * state.iterations(), benchmark::Counter::kIsRate,
+    benchmark::Counter::OneK::kIs1024);
+}
+// Arguments: {corpus bytes, pattern set, engine}
+static void MultiPatternArgs(benchmark::internal::Benchmark* b) {
+  for (int engine : {kScanPerPattern, kScanAlternation, kScanXpressive, kScanPrefilter}) {
+    for (int pattern_set : {kEmailPattern, kAllPatterns}) {
+      for (int corpus_size : {1 << 20, 8 << 20}) {
+        b->Args({corpus_size, pattern_set, engine});
+      }
+    }
+  }
+}
+BENCHMARK(BM_BoostRegexMultiPattern)->Apply(MultiPatternArgs)->Unit(benchmark::kMillisecond);
+
 // Benchmark for boost::format
 static void BM_BoostFormat(benchmark::State& state) {
   // Parameter represents the number of substitutions
@@ -126,6 +651,7 @@ static void BM_BoostFormat(benchmark::State& state) {
   
   boost::format fmt(fmt_string);
   
+  allocations::Tracker allocation_tracker;
   for (auto _ : state) {
     // Reset format
     fmt.clear();
@@ -139,6 +665,7 @@ static void BM_BoostFormat(benchmark::State& state) {
     std::string final_str = result.str();
     benchmark::DoNotOptimize(final_str);
   }
+  allocation_tracker.report(state);
   
   state.counters["ParamCount"] = param_count;
 }
@@ -147,4 +674,374 @@ BENCHMARK(BM_BoostFormat)
   ->Arg(5)    // Medium number of parameters 
   ->Arg(10);  // Many parameters
 
+// Structured-log line formatting: the same templates rendered by each
+// formatting approach, one line per iteration with arguments cycling
+// through a table of records. Time per iteration is the cost of one
+// format and AllocsPerIter the allocations per format.
+
+enum FormatEngine {
+  kFormatBoost = 0,     // boost::str(boost::format(...) % ...)
+  kFormatOstringstream, // std::ostringstream
+  kFormatFmtRuntime,    // fmt::format, parsing the format string at run time
+  kFormatFmtCompile,    // fmt::format_to with FMT_COMPILE into a reused buffer
+  kFormatAppendBuffer   // Reused std::string with literals and to_chars appended
+};
+
+struct LogRecord {
+  std::string user;
+  std::string host;
+  std::uint64_t request_id;
+  int status;
+  std::uint64_t bytes;
+  double latency_ms;
+};
+
+static std::vector<LogRecord> log_records(std::size_t count) {
+  static const char* const users[] = {"alice", "bob", "carol.smith", "dave_ops", "eve"};
+  static const char* const hosts[] = {"10.0.0.12", "gateway-3.internal", "192.168.100.254", "localhost"};
+  static const int statuses[] = {200, 201, 204, 301, 404, 500, 503};
+  std::vector<LogRecord> records;
+  for (std::size_t i = 0; i < count; ++i) {
+    std::uint64_t key = workloads::integer_key(workloads::kRandomKeys, i);
+    records.push_back({users[key % 5], hosts[(key >> 8) % 4], key >> 20, statuses[(key >> 16) % 7],
+                       (key >> 32) % 1000000, static_cast<double>((key >> 40) % 1000000) / 1000.0});
+  }
+  return records;
+}
+
+static void append_integer(std::string& out, std::uint64_t value) {
+  char buffer[20];
+  std::to_chars_result result = std::to_chars(buffer, buffer + sizeof(buffer), value);
+  out.append(buffer, result.ptr);
+}
+
+static void append_fixed3(std::string& out, double value) {
+  char buffer[32];
+#if defined(__cpp_lib_to_chars)
+  std::to_chars_result result = std::to_chars(buffer, buffer + sizeof(buffer), value, std::chars_format::fixed, 3);
+  out.append(buffer, result.ptr);
+#else
+  out.append(buffer, std::snprintf(buffer, sizeof(buffer), "%.3f", value));
+#endif
+}
+
+// "user=<name> host=<host> status=<int> bytes=<int>": mostly strings
+struct MixedLogLine {
+  static std::string boost(const LogRecord& r) {
+    return boost::str(boost::format("user=%s host=%s status=%d bytes=%d") % r.user % r.host % r.status % r.bytes);
+  }
+  static std::string ostream(const LogRecord& r) {
+    std::ostringstream out;
+    out << "user=" << r.user << " host=" << r.host << " status=" << r.status << " bytes=" << r.bytes;
+    return out.str();
+  }
+  static std::string fmt_runtime(const LogRecord& r) {
+    return fmt::format("user={} host={} status={} bytes={}", r.user, r.host, r.status, r.bytes);
+  }
+  static void fmt_compile(fmt::memory_buffer& out, const LogRecord& r) {
+    fmt::format_to(std::back_inserter(out), FMT_COMPILE("user={} host={} status={} bytes={}"),
+                   r.user, r.host, r.status, r.bytes);
+  }
+  static void append(std::string& out, const LogRecord& r) {
+    out += "user=";
+    out += r.user;
+    out += " host=";
+    out += r.host;
+    out += " status=";
+    append_integer(out, r.status);
+    out += " bytes=";
+    append_integer(out, r.bytes);
+  }
+};
+
+// "req=<int> status=<int> bytes=<int> latency=<fixed 3>ms": all numeric
+struct NumericLogLine {
+  static std::string boost(const LogRecord& r) {
+    return boost::str(boost::format("req=%d status=%d bytes=%d latency=%.3fms") % r.request_id % r.status % r.bytes %
+                      r.latency_ms);
+  }
+  static std::string ostream(const LogRecord& r) {
+    std::ostringstream out;
+    out << "req=" << r.request_id << " status=" << r.status << " bytes=" << r.bytes << " latency=" << std::fixed
+        << std::setprecision(3) << r.latency_ms << "ms";
+    return out.str();
+  }
+  static std::string fmt_runtime(const LogRecord& r) {
+    return fmt::format("req={} status={} bytes={} latency={:.3f}ms", r.request_id, r.status, r.bytes, r.latency_ms);
+  }
+  static void fmt_compile(fmt::memory_buffer& out, const LogRecord& r) {
+    fmt::format_to(std::back_inserter(out), FMT_COMPILE("req={} status={} bytes={} latency={:.3f}ms"),
+                   r.request_id, r.status, r.bytes, r.latency_ms);
+  }
+  static void append(std::string& out, const LogRecord& r) {
+    out += "req=";
+    append_integer(out, r.request_id);
+    out += " status=";
+    append_integer(out, r.status);
+    out += " bytes=";
+    append_integer(out, r.bytes);
+    out += " latency=";
+    append_fixed3(out, r.latency_ms);
+    out += "ms";
+  }
+};
+
+template <typename LogLine>
+static void BM_FormatLogLine(benchmark::State& state) {
+  const int engine = state.range(0);
+  const std::vector<LogRecord> records = log_records(1024);
+  
+  fmt::memory_buffer fmt_buffer;
+  std::string append_buffer;
+  append_buffer.reserve(256);
+  std::size_t index = 0;
+  std::size_t length = 0;
+  
+  allocations::Tracker allocation_tracker;
+  for (auto _ : state) {
+    const LogRecord& record = records[index++ & 1023];
+    switch (engine) {
+      case kFormatBoost: {
+        std::string line = LogLine::boost(record);
+        length += line.size();
+        benchmark::DoNotOptimize(line.data());
+        break;
+      }
+      case kFormatOstringstream: {
+        std::string line = LogLine::ostream(record);
+        length += line.size();
+        benchmark::DoNotOptimize(line.data());
+        break;
+      }
+      case kFormatFmtRuntime: {
+        std::string line = LogLine::fmt_runtime(record);
+        length += line.size();
+        benchmark::DoNotOptimize(line.data());
+        break;
+      }
+      case kFormatFmtCompile:
+        fmt_buffer.clear();
+        LogLine::fmt_compile(fmt_buffer, record);
+        length += fmt_buffer.size();
+        benchmark::DoNotOptimize(fmt_buffer.data());
+        break;
+      case kFormatAppendBuffer:
+        append_buffer.clear();
+        LogLine::append(append_buffer, record);
+        length += append_buffer.size();
+        benchmark::DoNotOptimize(append_buffer.data());
+        break;
+    }
+    benchmark::ClobberMemory();
+  }
+  allocation_tracker.report(state);
+  
+  state.counters["LineLength"] = benchmark::Counter(static_cast<double>(length), benchmark::Counter::kAvgIterations);
+}
+// Argument: engine
+BENCHMARK_TEMPLATE(BM_FormatLogLine, MixedLogLine)->DenseRange(kFormatBoost, kFormatAppendBuffer);
+BENCHMARK_TEMPLATE(BM_FormatLogLine, NumericLogLine)->DenseRange(kFormatBoost, kFormatAppendBuffer);
+
+// String interning: each distinct string is copied once into a monotonic
+// arena and identified by a dense 32-bit id. The hash table indexes views
+// of the arena copies, so neither lookups nor the table own any string.
+class StringPool {
+public:
+  static const std::uint32_t npos = std::uint32_t(-1);
+  
+  std::uint32_t intern(std::string_view text) {
+    auto found = m_ids.find(text);
+    if (found != m_ids.end()) {
+      return found->second;
+    }
+    char* copy = static_cast<char*>(m_arena.allocate(text.empty() ? 1 : text.size(), 1));
+    std::memcpy(copy, text.data(), text.size());
+    std::string_view stored(copy, text.size());
+    std::uint32_t id = static_cast<std::uint32_t>(m_strings.size());
+    m_strings.push_back(stored);
+    m_ids.emplace(stored, id);
+    return id;
+  }
+  
+  // Id of an interned string, or npos
+  std::uint32_t find(std::string_view text) const {
+    auto found = m_ids.find(text);
+    return found == m_ids.end() ? npos : found->second;
+  }
+  
+  std::string_view str(std::uint32_t id) const { return m_strings[id]; }
+  std::size_t size() const { return m_strings.size(); }
+  
+private:
+  boost::container::pmr::monotonic_buffer_resource m_arena;
+  std::unordered_map<std::string_view, std::uint32_t> m_ids;
+  std::vector<std::string_view> m_strings;
+};
+
+// count tags drawn with repetition from cardinality distinct values, as a
+// high-cardinality metrics or tracing pipeline receives them
+static std::vector<std::string> tag_stream(std::size_t count, std::size_t cardinality) {
+  std::vector<std::string> tags;
+  tags.reserve(count);
+  for (std::size_t i = 0; i < count; ++i) {
+    std::uint64_t tag = workloads::mix64(i) % cardinality;
+    tags.push_back("tag:" + std::to_string(workloads::integer_key(workloads::kRandomKeys, tag)));
+  }
+  return tags;
+}
+
+// Keeping every tag of a stream: as owning std::string copies, or as
+// interned ids. BytesSaved compares the live heap of both representations.
+static void BM_StringInternPool(benchmark::State& state) {
+  const std::size_t cardinality = state.range(0);
+  const bool intern = state.range(1);
+  const std::vector<std::string> tags = tag_stream(1 << 18, cardinality);
+  
+  allocations::Totals copies;
+  {
+    allocations::Tracker copy_tracker;
+    std::vector<std::string> kept(tags.begin(), tags.end());
+    copies = copy_tracker.stop();
+  }
+  
+  std::size_t distinct = 0;
+  allocations::Tracker allocation_tracker;
+  for (auto _ : state) {
+    if (intern) {
+      StringPool pool;
+      std::vector<std::uint32_t> kept;
+      kept.reserve(tags.size());
+      for (const std::string& tag : tags) {
+        kept.push_back(pool.intern(tag));
+      }
+      distinct = pool.size();
+      benchmark::DoNotOptimize(kept.data());
+    } else {
+      std::vector<std::string> kept;
+      kept.reserve(tags.size());
+      for (const std::string& tag : tags) {
+        kept.push_back(tag);
+      }
+      benchmark::DoNotOptimize(kept.data());
+    }
+  }
+  allocations::Totals totals = allocation_tracker.report(state);
+  
+  state.counters["Tags"] = tags.size();
+  state.counters["Cardinality"] = cardinality;
+  if (intern) {
+    state.counters["DistinctTags"] = distinct;
+    state.counters["BytesSaved"] = benchmark::Counter(
+      static_cast<double>(copies.peak_live_bytes - totals.peak_live_bytes), benchmark::Counter::kDefaults,
+      benchmark::Counter::OneK::kIs1024);
+  }
+}
+BENCHMARK(BM_StringInternPool)
+  ->Args({1000, 0})     // Owning copies, low cardinality
+  ->Args({1000, 1})     // Interned, low cardinality
+  ->Args({100000, 0})   // Owning copies, high cardinality
+  ->Args({100000, 1})   // Interned, high cardinality
+  ->Unit(benchmark::kMicrosecond);
+
+// Small-string optimization: constructing and copying a string of a given
+// length. AllocsPerIter drops to zero while the string fits inline
+// (15 characters for libstdc++ std::string, more for boost::container::string).
+template <typename String>
+static void BM_SmallString(benchmark::State& state) {
+  const std::size_t length = state.range(0);
+  const std::string source(length, 'x');
+  
+  allocations::Tracker allocation_tracker;
+  for (auto _ : state) {
+    String text(source.data(), length);
+    String copy(text);
+    benchmark::DoNotOptimize(text.data());
+    benchmark::DoNotOptimize(copy.data());
+  }
+  allocation_tracker.report(state);
+  
+  state.counters["Length"] = length;
+  state.counters["ObjectSize"] = sizeof(String);
+}
+static void SmallStringArgs(benchmark::internal::Benchmark* b) {
+  for (int length : {1, 7, 8, 15, 16, 22, 23, 24, 31, 32, 64}) {
+    b->Arg(length);
+  }
+}
+BENCHMARK_TEMPLATE(BM_SmallString, std::string)->Apply(SmallStringArgs);
+BENCHMARK_TEMPLATE(BM_SmallString, boost::container::string)->Apply(SmallStringArgs);
+
+enum TagKey {
+  kStringKeyedMap = 0, // std::map<std::string, V>
+  kInternedIdMap,      // std::map<std::uint32_t, V> keyed by interned id
+  kStringKeyedHash,    // std::unordered_map<std::string, V>
+  kInternedIdHash      // std::unordered_map<std::uint32_t, V> keyed by interned id
+};
+
+// Map lookups keyed by the tag strings or by their interned ids, for tags
+// that were interned when they entered the process
+static void BM_TagMapLookup(benchmark::State& state) {
+  const std::size_t cardinality = state.range(0);
+  const int key = state.range(1);
+  const std::vector<std::string> tags = tag_stream(1 << 16, cardinality);
+  
+  StringPool pool;
+  std::vector<std::uint32_t> ids;
+  for (const std::string& tag : tags) {
+    ids.push_back(pool.intern(tag));
+  }
+  
+  std::map<std::string, std::uint64_t> string_map;
+  std::map<std::uint32_t, std::uint64_t> id_map;
+  std::unordered_map<std::string, std::uint64_t> string_hash;
+  std::unordered_map<std::uint32_t, std::uint64_t> id_hash;
+  for (std::uint32_t id = 0; id < pool.size(); ++id) {
+    string_map.emplace(std::string(pool.str(id)), id);
+    id_map.emplace(id, id);
+    string_hash.emplace(std::string(pool.str(id)), id);
+    id_hash.emplace(id, id);
+  }
+  
+  for (auto _ : state) {
+    std::uint64_t sum = 0;
+    switch (key) {
+      case kStringKeyedMap:
+        for (const std::string& tag : tags) {
+          sum += string_map.find(tag)->second;
+        }
+        break;
+      case kInternedIdMap:
+        for (std::uint32_t id : ids) {
+          sum += id_map.find(id)->second;
+        }
+        break;
+      case kStringKeyedHash:
+        for (const std::string& tag : tags) {
+          sum += string_hash.find(tag)->second;
+        }
+        break;
+      case kInternedIdHash:
+        for (std::uint32_t id : ids) {
+          sum += id_hash.find(id)->second;
+        }
+        break;
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  
+  state.counters["Cardinality"] = cardinality;
+  state.counters["LookupLatency"] = benchmark::Counter(
+    static_cast<double>(tags.size()) * state.iterations(),
+    benchmark::Counter::kIsRate | benchmark::Counter::kInvert);
+}
+// Arguments: {cardinality, key}
+static void TagMapArgs(benchmark::internal::Benchmark* b) {
+  for (int key : {kStringKeyedMap, kInternedIdMap, kStringKeyedHash, kInternedIdHash}) {
+    for (int cardinality : {1000, 100000}) {
+      b->Args({cardinality, key});
+    }
+  }
+}
+BENCHMARK(BM_TagMapLookup)->Apply(TagMapArgs)->Unit(benchmark::kMicrosecond);
+
 BENCHMARK_MAIN();
\ No newline at end of file
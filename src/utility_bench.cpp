@@ -1,12 +1,36 @@
 #include <benchmark/benchmark.h>
 #include <boost/any.hpp>
+#include <boost/version.hpp>
+#if BOOST_VERSION >= 107900
+#include <boost/any/basic_any.hpp>
+#endif
 #include <boost/algorithm/cxx11/all_of.hpp>
 #include <boost/uuid/uuid.hpp>
 #include <boost/uuid/uuid_generators.hpp>
 #include <boost/uuid/uuid_io.hpp>
+#include <boost/variant2/variant.hpp>
+#if BOOST_VERSION >= 108600
+#include <boost/uuid/time_generator_v7.hpp>
+#endif
+#include "common/allocation_tracker.hpp"
+#include "common/workloads.hpp"
+#include <any>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <random>
 #include <string>
+#include <type_traits>
+#include <utility>
+#include <variant>
 #include <vector>
 
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define BOOST_BENCH_X86_SIMD 1
+#endif
+
 // Benchmark for boost::any
 static void BM_BoostAny(benchmark::State& state) {
   // Parameter represents the number of type changes and casts
@@ -47,6 +71,229 @@ BENCHMARK(BM_BoostAny)
   ->Arg(10)    // Medium operations
   ->Arg(30);   // Many operations
 
+// Type-erased event payloads: 1M payloads are stored in one vector and
+// every iteration dispatches on each payload's type. Homogeneous vectors
+// hold only Quad; heterogeneous vectors draw int64, double, Quad and short
+// std::string at random so the type test cannot be predicted.
+// AllocsPerPayload counts heap allocations while building the vector,
+// beyond the vector's own storage.
+
+struct Quad {
+  double x, y, z, w;
+};
+
+typedef boost::variant2::variant<std::int64_t, double, Quad, std::string> PayloadVariant2;
+typedef std::variant<std::int64_t, double, Quad, std::string> PayloadStdVariant;
+
+// Move-only any with Capacity bytes of inline storage. Each stored type has
+// one static vtable, so a type test is a pointer comparison rather than a
+// std::type_info comparison. Types that do not fit, or whose move may
+// throw, are stored on the heap.
+template <std::size_t Capacity>
+class UniqueAny {
+public:
+  UniqueAny() = default;
+  
+  template <typename T, typename = std::enable_if_t<!std::is_same<std::decay_t<T>, UniqueAny>::value>>
+  UniqueAny(T&& value) {
+    typedef std::decay_t<T> Value;
+    if constexpr (Ops<Value>::is_inline) {
+      new (m_buffer) Value(std::forward<T>(value));
+    } else {
+      m_heap = new Value(std::forward<T>(value));
+    }
+    m_vtable = &Ops<Value>::vtable;
+  }
+  
+  UniqueAny(UniqueAny&& other) noexcept { take(other); }
+  
+  UniqueAny& operator=(UniqueAny&& other) noexcept {
+    if (this != &other) {
+      reset();
+      take(other);
+    }
+    return *this;
+  }
+  
+  UniqueAny(const UniqueAny&) = delete;
+  UniqueAny& operator=(const UniqueAny&) = delete;
+  
+  ~UniqueAny() { reset(); }
+  
+  // The stored value if it has type T, otherwise nullptr
+  template <typename T>
+  const T* get() const {
+    return m_vtable == &Ops<T>::vtable ? Ops<T>::ptr(const_cast<UniqueAny&>(*this)) : nullptr;
+  }
+  
+  void reset() {
+    if (m_vtable) {
+      m_vtable->destroy(*this);
+      m_vtable = nullptr;
+    }
+  }
+  
+private:
+  struct VTable {
+    void (*destroy)(UniqueAny&);
+    void (*move)(UniqueAny& from, UniqueAny& to);
+  };
+  
+  template <typename T>
+  struct Ops {
+    static constexpr bool is_inline = sizeof(T) <= Capacity && alignof(T) <= alignof(std::max_align_t) &&
+                                      std::is_nothrow_move_constructible<T>::value;
+    
+    static T* ptr(UniqueAny& any) {
+      if constexpr (is_inline) {
+        return std::launder(reinterpret_cast<T*>(any.m_buffer));
+      } else {
+        return static_cast<T*>(any.m_heap);
+      }
+    }
+    
+    static void destroy(UniqueAny& any) {
+      if constexpr (is_inline) {
+        ptr(any)->~T();
+      } else {
+        delete ptr(any);
+      }
+    }
+    
+    static void move(UniqueAny& from, UniqueAny& to) {
+      if constexpr (is_inline) {
+        new (to.m_buffer) T(std::move(*ptr(from)));
+        ptr(from)->~T();
+      } else {
+        to.m_heap = from.m_heap;
+      }
+    }
+    
+    static inline const VTable vtable = {&destroy, &move};
+  };
+  
+  void take(UniqueAny& other) noexcept {
+    if (other.m_vtable) {
+      other.m_vtable->move(other, *this);
+      m_vtable = other.m_vtable;
+      other.m_vtable = nullptr;
+    }
+  }
+  
+  union {
+    alignas(std::max_align_t) unsigned char m_buffer[Capacity];
+    void* m_heap;
+  };
+  const VTable* m_vtable = nullptr;
+};
+
+// Typed access to a stored payload, nullptr on a type mismatch
+template <typename T>
+const T* payload_ptr(const boost::any& payload) { return boost::any_cast<T>(&payload); }
+template <typename T>
+const T* payload_ptr(const std::any& payload) { return std::any_cast<T>(&payload); }
+#if BOOST_VERSION >= 107900
+template <typename T, std::size_t BufferSize, std::size_t Alignment>
+const T* payload_ptr(const boost::anys::basic_any<BufferSize, Alignment>& payload) {
+  return boost::anys::any_cast<T>(&payload);
+}
+#endif
+template <typename T, std::size_t Capacity>
+const T* payload_ptr(const UniqueAny<Capacity>& payload) { return payload.template get<T>(); }
+
+struct PayloadWeight {
+  double operator()(std::int64_t value) const { return static_cast<double>(value); }
+  double operator()(double value) const { return value; }
+  double operator()(const Quad& value) const { return value.x + value.y + value.z + value.w; }
+  double operator()(const std::string& value) const { return static_cast<double>(value.size()); }
+};
+
+// Type tests in a fixed order, as an event bus handler would write them
+template <typename Any>
+double payload_weight(const Any& payload) {
+  PayloadWeight weight;
+  if (const std::int64_t* value = payload_ptr<std::int64_t>(payload)) {
+    return weight(*value);
+  }
+  if (const double* value = payload_ptr<double>(payload)) {
+    return weight(*value);
+  }
+  if (const Quad* value = payload_ptr<Quad>(payload)) {
+    return weight(*value);
+  }
+  if (const std::string* value = payload_ptr<std::string>(payload)) {
+    return weight(*value);
+  }
+  return 0;
+}
+
+static double payload_weight(const PayloadVariant2& payload) { return boost::variant2::visit(PayloadWeight(), payload); }
+static double payload_weight(const PayloadStdVariant& payload) { return std::visit(PayloadWeight(), payload); }
+
+template <typename Payload>
+static Payload make_payload(std::size_t index, bool mixed) {
+  const std::uint64_t key = workloads::integer_key(workloads::kRandomKeys, index);
+  const double value = static_cast<double>(key >> 44);
+  switch (mixed ? key % 4 : 2) {
+    case 0:
+      return Payload(static_cast<std::int64_t>(key >> 1));
+    case 1:
+      return Payload(value);
+    case 2:
+      return Payload(Quad{value, value + 1, value + 2, value + 3});
+    default:
+      return Payload(std::string("event-") + std::to_string(key % 100000));
+  }
+}
+
+template <typename Payload>
+static void BM_TypeErasedPayloads(benchmark::State& state) {
+  const std::size_t count = state.range(0);
+  const bool mixed = state.range(1);
+  
+  std::vector<Payload> payloads;
+  payloads.reserve(count);
+  allocations::Totals construction;
+  {
+    allocations::Tracker construction_tracker;
+    for (std::size_t i = 0; i < count; ++i) {
+      payloads.push_back(make_payload<Payload>(i, mixed));
+    }
+    construction = construction_tracker.stop();
+  }
+  
+  for (auto _ : state) {
+    double sum = 0;
+    for (const Payload& payload : payloads) {
+      sum += payload_weight(payload);
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  
+  state.counters["Payloads"] = count;
+  state.counters["PayloadSize"] = sizeof(Payload);
+  state.counters["AllocsPerPayload"] = static_cast<double>(construction.allocations) / count;
+  state.counters["DispatchLatency"] = benchmark::Counter(
+    static_cast<double>(count) * state.iterations(), benchmark::Counter::kIsRate | benchmark::Counter::kInvert);
+}
+
+#define TYPE_ERASED_PAYLOADS(Payload)                  \
+  BENCHMARK_TEMPLATE(BM_TypeErasedPayloads, Payload)   \
+    ->Args({1000000, 0}) /* Homogeneous */             \
+    ->Args({1000000, 1}) /* Heterogeneous */           \
+    ->Unit(benchmark::kMillisecond)
+
+TYPE_ERASED_PAYLOADS(boost::any);
+#if BOOST_VERSION >= 107900
+TYPE_ERASED_PAYLOADS(boost::anys::basic_any<16>);
+TYPE_ERASED_PAYLOADS(boost::anys::basic_any<32>);
+#endif
+TYPE_ERASED_PAYLOADS(std::any);
+TYPE_ERASED_PAYLOADS(PayloadVariant2);
+TYPE_ERASED_PAYLOADS(PayloadStdVariant);
+TYPE_ERASED_PAYLOADS(UniqueAny<16>);
+TYPE_ERASED_PAYLOADS(UniqueAny<32>);
+
 // Benchmark for boost algorithm
 static void BM_BoostAllOf(benchmark::State& state) {
   const int SIZE = state.range(0);
@@ -91,4 +338,258 @@ BENCHMARK(BM_BoostUUID)
   ->Arg(5)      // Few UUIDs
   ->Arg(20);    // Many UUIDs
 
+// Batched UUID generation: each iteration fills a caller-owned batch of
+// UUIDs. Every thread owns its generator, so ->Threads() measures scaling
+// without contention; UUIDsPerSecond sums over threads and
+// UUIDsPerSecondPerThread averages them.
+
+enum UUIDGenerator {
+  kRandomGenerator = 0,    // boost::uuids::random_generator
+  kRandomGeneratorMt19937, // boost::uuids::random_generator_mt19937
+  kTimeGeneratorV7,        // boost::uuids::time_generator_v7 (Boost 1.86+)
+  kNameGeneratorV5,        // SHA-1 name-based UUIDs of distinct names
+  kBulkMt19937_64          // One std::mt19937_64 draw for the whole batch
+};
+
+// Random (version 4, RFC 4122 variant) UUIDs from one bulk PRNG: each UUID
+// takes two 64-bit draws, copied in bytewise, then the version and variant
+// bits are stamped in
+static void bulk_random_uuids(std::mt19937_64& gen, boost::uuids::uuid* out, std::size_t count) {
+  for (std::size_t i = 0; i < count; ++i) {
+    const std::uint64_t words[2] = {gen(), gen()};
+    std::memcpy(out[i].begin(), words, sizeof(words));
+    out[i].data[6] = static_cast<std::uint8_t>((out[i].data[6] & 0x0F) | 0x40);
+    out[i].data[8] = static_cast<std::uint8_t>((out[i].data[8] & 0x3F) | 0x80);
+  }
+}
+
+static void BM_BoostUUIDBatch(benchmark::State& state) {
+  const std::size_t count = state.range(0);
+  const int generator = state.range(1);
+  
+#if BOOST_VERSION < 108600
+  if (generator == kTimeGeneratorV7) {
+    state.SkipWithError("time_generator_v7 requires Boost 1.86");
+    return;
+  }
+#endif
+  
+  std::vector<boost::uuids::uuid> batch(count);
+  std::vector<std::string> names;
+  for (std::size_t i = 0; i < count; ++i) {
+    names.push_back("request-" + std::to_string(state.thread_index() * count + i));
+  }
+  
+  boost::uuids::random_generator random_gen;
+  boost::uuids::random_generator_mt19937 mt19937_gen;
+#if BOOST_VERSION >= 108600
+  boost::uuids::time_generator_v7 time_gen;
+#endif
+  boost::uuids::name_generator_sha1 name_gen(boost::uuids::ns::dns());
+  std::mt19937_64 bulk_gen(random_gen().data[0] + state.thread_index());
+  
+  for (auto _ : state) {
+    switch (generator) {
+      case kRandomGenerator:
+        for (auto& id : batch) {
+          id = random_gen();
+        }
+        break;
+      case kRandomGeneratorMt19937:
+        for (auto& id : batch) {
+          id = mt19937_gen();
+        }
+        break;
+#if BOOST_VERSION >= 108600
+      case kTimeGeneratorV7:
+        for (auto& id : batch) {
+          id = time_gen();
+        }
+        break;
+#endif
+      case kNameGeneratorV5:
+        for (std::size_t i = 0; i < count; ++i) {
+          batch[i] = name_gen(names[i]);
+        }
+        break;
+      case kBulkMt19937_64:
+        bulk_random_uuids(bulk_gen, batch.data(), count);
+        break;
+    }
+    benchmark::DoNotOptimize(batch.data());
+    benchmark::ClobberMemory();
+  }
+  
+  state.counters["BatchSize"] = benchmark::Counter(count, benchmark::Counter::kAvgThreads);
+  state.counters["UUIDsPerSecond"] = benchmark::Counter(
+    static_cast<double>(count) * state.iterations(), benchmark::Counter::kIsRate);
+  state.counters["UUIDsPerSecondPerThread"] = benchmark::Counter(
+    static_cast<double>(count) * state.iterations(), benchmark::Counter::kAvgThreadsRate);
+}
+// Arguments: {batch size, generator}
+static void UUIDBatchArgs(benchmark::internal::Benchmark* b) {
+  for (int generator : {kRandomGenerator, kRandomGeneratorMt19937, kTimeGeneratorV7, kNameGeneratorV5,
+                        kBulkMt19937_64}) {
+    for (int count : {16, 1024}) {
+      b->Args({count, generator});
+    }
+  }
+}
+BENCHMARK(BM_BoostUUIDBatch)->Apply(UUIDBatchArgs)->Threads(1)->Threads(4)->UseRealTime();
+
+// Hex formatting of a batch of UUIDs into the canonical 36-character form.
+// Every encoder except to_string writes into one caller-provided buffer,
+// so no strings are allocated.
+
+enum UUIDHexEncoder {
+  kHexToString = 0, // boost::uuids::to_string
+  kHexToChars,      // boost::uuids::to_chars into the buffer (Boost 1.86+)
+  kHexLookupTable,  // 256-entry table of two-character byte encodings
+  kHexSse2          // Nibble split and compare-based digit selection in SSE2
+};
+
+static const std::size_t uuid_text_size = 36;
+
+// Writes the hyphens of the canonical form around 32 hex digits
+static inline void place_uuid_hex(const char* hex, char* out) {
+  std::memcpy(out, hex, 8);
+  out[8] = '-';
+  std::memcpy(out + 9, hex + 8, 4);
+  out[13] = '-';
+  std::memcpy(out + 14, hex + 12, 4);
+  out[18] = '-';
+  std::memcpy(out + 19, hex + 16, 4);
+  out[23] = '-';
+  std::memcpy(out + 24, hex + 20, 12);
+}
+
+struct HexTable {
+  HexTable() {
+    for (int byte = 0; byte < 256; ++byte) {
+      pairs[2 * byte] = "0123456789abcdef"[byte >> 4];
+      pairs[2 * byte + 1] = "0123456789abcdef"[byte & 15];
+    }
+  }
+  char pairs[512];
+};
+
+static void encode_uuid_lookup(const boost::uuids::uuid& id, char* out) {
+  static const HexTable table;
+  char hex[32];
+  for (int i = 0; i < 16; ++i) {
+    std::memcpy(hex + 2 * i, table.pairs + 2 * id.data[i], 2);
+  }
+  place_uuid_hex(hex, out);
+}
+
+#ifdef BOOST_BENCH_X86_SIMD
+static void encode_uuid_sse2(const boost::uuids::uuid& id, char* out) {
+  const __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(id.data));
+  const __m128i low_mask = _mm_set1_epi8(0x0F);
+  const __m128i high = _mm_and_si128(_mm_srli_epi16(bytes, 4), low_mask);
+  const __m128i low = _mm_and_si128(bytes, low_mask);
+  // Digits in output order: high nibble first
+  __m128i first = _mm_unpacklo_epi8(high, low);
+  __m128i second = _mm_unpackhi_epi8(high, low);
+  // '0' + n, plus ('a' - '0' - 10) where n > 9
+  const __m128i nine = _mm_set1_epi8(9);
+  const __m128i zero = _mm_set1_epi8('0');
+  const __m128i letter_offset = _mm_set1_epi8('a' - '0' - 10);
+  first = _mm_add_epi8(_mm_add_epi8(first, zero), _mm_and_si128(_mm_cmpgt_epi8(first, nine), letter_offset));
+  second = _mm_add_epi8(_mm_add_epi8(second, zero), _mm_and_si128(_mm_cmpgt_epi8(second, nine), letter_offset));
+  char hex[32];
+  _mm_storeu_si128(reinterpret_cast<__m128i*>(hex), first);
+  _mm_storeu_si128(reinterpret_cast<__m128i*>(hex + 16), second);
+  place_uuid_hex(hex, out);
+}
+#endif
+
+static void BM_BoostUUIDHexEncode(benchmark::State& state) {
+  const std::size_t count = state.range(0);
+  const int encoder = state.range(1);
+  
+#if BOOST_VERSION < 108600
+  if (encoder == kHexToChars) {
+    state.SkipWithError("boost::uuids::to_chars requires Boost 1.86");
+    return;
+  }
+#endif
+#ifndef BOOST_BENCH_X86_SIMD
+  if (encoder == kHexSse2) {
+    state.SkipWithError("x86 SIMD not available on this target");
+    return;
+  }
+#endif
+  
+  std::vector<boost::uuids::uuid> batch(count);
+  std::mt19937_64 gen(workloads::default_seed());
+  bulk_random_uuids(gen, batch.data(), count);
+  std::vector<char> buffer(count * uuid_text_size);
+  
+  // Every encoder must agree with to_string
+  for (std::size_t i = 0; i < count; ++i) {
+    encode_uuid_lookup(batch[i], &buffer[i * uuid_text_size]);
+    if (std::string(&buffer[i * uuid_text_size], uuid_text_size) != boost::uuids::to_string(batch[i])) {
+      state.SkipWithError("Lookup table encoder disagrees with to_string");
+      return;
+    }
+#ifdef BOOST_BENCH_X86_SIMD
+    encode_uuid_sse2(batch[i], &buffer[i * uuid_text_size]);
+    if (std::string(&buffer[i * uuid_text_size], uuid_text_size) != boost::uuids::to_string(batch[i])) {
+      state.SkipWithError("SSE2 encoder disagrees with to_string");
+      return;
+    }
+#endif
+  }
+  
+  allocations::Tracker allocation_tracker;
+  for (auto _ : state) {
+    char* out = buffer.data();
+    switch (encoder) {
+      case kHexToString:
+        for (const auto& id : batch) {
+          std::string text = boost::uuids::to_string(id);
+          benchmark::DoNotOptimize(text.data());
+        }
+        break;
+#if BOOST_VERSION >= 108600
+      case kHexToChars:
+        for (const auto& id : batch) {
+          boost::uuids::to_chars(id, out, out + uuid_text_size);
+          out += uuid_text_size;
+        }
+        break;
+#endif
+      case kHexLookupTable:
+        for (const auto& id : batch) {
+          encode_uuid_lookup(id, out);
+          out += uuid_text_size;
+        }
+        break;
+#ifdef BOOST_BENCH_X86_SIMD
+      case kHexSse2:
+        for (const auto& id : batch) {
+          encode_uuid_sse2(id, out);
+          out += uuid_text_size;
+        }
+        break;
+#endif
+    }
+    benchmark::DoNotOptimize(buffer.data());
+    benchmark::ClobberMemory();
+  }
+  allocation_tracker.report(state);
+  
+  state.counters["BatchSize"] = count;
+  state.counters["UUIDsPerSecond"] = benchmark::Counter(
+    static_cast<double>(count) * state.iterations(), benchmark::Counter::kIsRate);
+}
+// Arguments: {batch size, encoder}
+static void UUIDHexEncodeArgs(benchmark::internal::Benchmark* b) {
+  for (int encoder : {kHexToString, kHexToChars, kHexLookupTable, kHexSse2}) {
+    b->Args({1024, encoder});
+  }
+}
+BENCHMARK(BM_BoostUUIDHexEncode)->Apply(UUIDHexEncodeArgs);
+
 BENCHMARK_MAIN();
\ No newline at end of file